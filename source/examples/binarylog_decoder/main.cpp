@@ -0,0 +1,57 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <loggingzeug/BinaryLogReader.h>
+#include <loggingzeug/ConsoleLogHandler.h>
+
+
+using namespace loggingzeug;
+
+// prints messages as ConsoleLogHandler does
+class DecodedLogHandler : public ConsoleLogHandler
+{
+public:
+    static std::string text(const LogMessage & message)
+    {
+        return messagePrefix(message) + message.message();
+    }
+};
+
+
+int main(int argc, char const *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: binarylogdecoder <logfile> [--timestamps]" << std::endl;
+        return 1;
+    }
+
+    const auto timestamps = argc > 2 && std::strcmp(argv[2], "--timestamps") == 0;
+
+    BinaryLogReader reader(argv[1]);
+
+    if (!reader.isValid())
+    {
+        std::cerr << "Could not read " << argv[1] << std::endl;
+        return 1;
+    }
+
+    for (const auto & record : reader.records())
+    {
+        if (timestamps)
+        {
+            const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(record.time.time_since_epoch()).count();
+
+            char time[32];
+            std::snprintf(time, sizeof(time), "%lld.%06lld ", static_cast<long long>(microseconds / 1000000), static_cast<long long>(microseconds % 1000000));
+            std::cout << time;
+        }
+
+        std::cout << DecodedLogHandler::text(record.message) << std::endl;
+    }
+
+    return 0;
+}
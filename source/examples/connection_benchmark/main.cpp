@@ -0,0 +1,175 @@
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <signalzeug/Signal.h>
+
+
+using namespace signalzeug;
+
+namespace
+{
+
+std::atomic<std::size_t> allocations(0);
+
+const std::size_t connections = 1 << 20;
+const std::size_t signals = 1 << 16;
+const std::size_t connectionsPerSignal = 16;
+const int repetitions = 5;
+
+double measure(const std::function<void()> & run)
+{
+    std::vector<double> times;
+
+    for (auto i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        run();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+void report(const std::string & name, double milliseconds, std::size_t operations, std::size_t allocated)
+{
+    std::cout << std::setw(24) << name
+        << std::setw(14) << std::fixed << std::setprecision(1) << milliseconds * 1e6 / operations
+        << std::setw(20) << std::setprecision(3) << static_cast<double>(allocated) / operations << std::endl;
+}
+
+} // namespace
+
+// counts heap allocations, so that the bookkeeping cost per connection becomes visible
+void * operator new(std::size_t size)
+{
+    ++allocations;
+
+    if (void * memory = std::malloc(size ? size : 1))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+// GCC mistakes the replaced operators for a mismatched pair once they are inlined
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+
+int main(int /*argc*/, char * /*argv*/[])
+{
+    std::cout << "median of " << repetitions << " runs" << std::endl;
+    std::cout << std::setw(24) << "" << std::setw(14) << "ns / op" << std::setw(20) << "allocations / op" << std::endl;
+
+    // connect many slots to one signal, then disconnect them in random order
+    {
+        Signal<int> signal;
+        auto handles = std::vector<Connection>(connections);
+        auto order = std::vector<std::size_t>(connections);
+
+        for (auto i = std::size_t(0); i < connections; ++i)
+            order[i] = i;
+
+        std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+        auto allocated = std::size_t(0);
+
+        const auto time = measure([&] ()
+        {
+            const auto before = allocations.load();
+
+            for (auto & handle : handles)
+                handle = signal.connect([] (int) { });
+
+            for (auto i : order)
+                handles[i].disconnect();
+
+            allocated = allocations.load() - before;
+        });
+
+        report("churn, one signal", time, connections, allocated);
+    }
+
+    // connect and disconnect a few slots to each of many signals, like views observing properties
+    {
+        auto observed = std::vector<std::unique_ptr<Signal<int>>>(signals);
+
+        for (auto & signal : observed)
+            signal.reset(new Signal<int>);
+
+        auto handles = std::vector<Connection>(signals * connectionsPerSignal);
+        auto allocated = std::size_t(0);
+
+        const auto time = measure([&] ()
+        {
+            const auto before = allocations.load();
+
+            for (auto i = std::size_t(0); i < handles.size(); ++i)
+                handles[i] = observed[i % signals]->connect([] (int) { });
+
+            for (auto & handle : handles)
+                handle.disconnect();
+
+            allocated = allocations.load() - before;
+        });
+
+        report("churn, many signals", time, handles.size(), allocated);
+    }
+
+    // keep connections to signals that are destroyed before them
+    {
+        auto handles = std::vector<Connection>(signals * connectionsPerSignal);
+        auto allocated = std::size_t(0);
+
+        const auto time = measure([&] ()
+        {
+            const auto before = allocations.load();
+
+            {
+                auto observed = std::vector<Signal<int>>(signals);
+
+                for (auto i = std::size_t(0); i < handles.size(); ++i)
+                    handles[i] = observed[i % signals].connect([] (int) { });
+            }
+
+            // the signals are gone, disconnecting does nothing
+            for (auto & handle : handles)
+                handle.disconnect();
+
+            allocated = allocations.load() - before;
+        });
+
+        report("signals destroyed first", time, handles.size(), allocated);
+    }
+
+    return 0;
+}
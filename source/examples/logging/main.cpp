@@ -3,6 +3,8 @@
 
 using namespace loggingzeug;
 
+LOGGINGZEUG_CONTEXT(ExampleLog, "D", Warning);
+
 
 int main(int argc, char const *argv[])
 {
@@ -19,5 +21,9 @@ int main(int argc, char const *argv[])
     fatal("C") << "Fatal message from context C";
 
 
+    LOGGINGZEUG_WARNING(ExampleLog) << "Warning from context D";
+    LOGGINGZEUG_DEBUG(ExampleLog) << "Debug message from context D, removed at compile time";
+
+
     return 0;
 }
@@ -0,0 +1,210 @@
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/LogMessage.h>
+#include <loggingzeug/LogMessageBuilder.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+std::atomic<std::size_t> allocations(0);
+
+const int messages = 1 << 18;
+const int repetitions = 5;
+
+// the previous LogMessageBuilder, formatting into a shared std::stringstream
+class StreamLogMessageBuilder
+{
+public:
+    StreamLogMessageBuilder(LogMessage::Level level, AbstractLogHandler * handler, const std::string & context)
+    : m_level(level)
+    , m_handler(handler)
+    , m_context(context)
+    , m_stream(new std::stringstream)
+    {
+    }
+
+    ~StreamLogMessageBuilder()
+    {
+        if (m_stream.use_count() > 1)
+            return;
+
+        m_handler->handle(LogMessage(m_level, m_stream->str(), m_context));
+    }
+
+    StreamLogMessageBuilder & operator<<(const char * c)
+    {
+        m_stream->write(c, std::char_traits<char>::length(c));
+        return *this;
+    }
+
+    StreamLogMessageBuilder & operator<<(const std::string & str)
+    {
+        m_stream->write(str.c_str(), str.length());
+        return *this;
+    }
+
+    template <typename T>
+    StreamLogMessageBuilder & operator<<(const T & value)
+    {
+        *m_stream << value;
+        return *this;
+    }
+
+protected:
+    LogMessage::Level m_level;
+    AbstractLogHandler * m_handler;
+    std::string m_context;
+    std::shared_ptr<std::stringstream> m_stream;
+};
+
+class DiscardingLogHandler : public AbstractLogHandler
+{
+public:
+    DiscardingLogHandler()
+    : characters(0)
+    {
+    }
+
+    virtual void handle(const LogMessage & message) override
+    {
+        characters += message.message().size();
+    }
+
+    std::size_t characters;
+};
+
+double measure(const std::function<void()> & run)
+{
+    std::vector<double> times;
+
+    for (auto i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        run();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+template <typename Builder>
+void shortText(AbstractLogHandler & handler, int /*i*/)
+{
+    Builder(LogMessage::Info, &handler, "render") << "Frame finished";
+}
+
+template <typename Builder>
+void integers(AbstractLogHandler & handler, int i)
+{
+    Builder(LogMessage::Info, &handler, "render") << "Frame " << i << " took " << i * 3 << " us for " << i * 7ull << " bytes";
+}
+
+template <typename Builder>
+void floats(AbstractLogHandler & handler, int i)
+{
+    Builder(LogMessage::Info, &handler, "render") << "Camera at " << i * 0.25 << ", " << i * -1.5 << ", " << 1.0 / (i + 1);
+}
+
+template <typename Builder>
+void longText(AbstractLogHandler & handler, int i)
+{
+    static const auto text = std::string(400, '.');
+    Builder(LogMessage::Info, &handler, "render") << "Shader log " << i << ": " << text;
+}
+
+void compare(const std::string & name, void (*stream)(AbstractLogHandler &, int), void (*buffer)(AbstractLogHandler &, int))
+{
+    DiscardingLogHandler handler;
+
+    auto run = [&handler] (void (*log)(AbstractLogHandler &, int), std::size_t & allocated)
+    {
+        return measure([&] ()
+        {
+            const auto before = allocations.load();
+
+            for (auto i = 0; i < messages; ++i)
+                log(handler, i);
+
+            allocated = allocations.load() - before;
+        });
+    };
+
+    auto streamAllocations = std::size_t(0);
+    auto bufferAllocations = std::size_t(0);
+
+    const auto streamTime = run(stream, streamAllocations);
+    const auto bufferTime = run(buffer, bufferAllocations);
+
+    std::cout << std::setw(16) << name << std::fixed
+        << std::setw(14) << std::setprecision(1) << streamTime * 1e6 / messages
+        << std::setw(14) << bufferTime * 1e6 / messages
+        << std::setw(16) << std::setprecision(2) << static_cast<double>(streamAllocations) / messages
+        << std::setw(16) << static_cast<double>(bufferAllocations) / messages << std::endl;
+}
+
+} // namespace
+
+// counts heap allocations per message
+void * operator new(std::size_t size)
+{
+    ++allocations;
+
+    if (void * memory = std::malloc(size ? size : 1))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+// GCC mistakes the replaced operators for a mismatched pair once they are inlined
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+
+int main(int /*argc*/, char * /*argv*/[])
+{
+    std::cout << "median of " << repetitions << " runs, ns and allocations per message" << std::endl;
+    std::cout << std::setw(16) << "" << std::setw(14) << "stringstream" << std::setw(14) << "buffer"
+        << std::setw(16) << "allocs (stream)" << std::setw(16) << "allocs (buffer)" << std::endl;
+
+    compare("short text", &shortText<StreamLogMessageBuilder>, &shortText<LogMessageBuilder>);
+    compare("integers", &integers<StreamLogMessageBuilder>, &integers<LogMessageBuilder>);
+    compare("floats", &floats<StreamLogMessageBuilder>, &floats<LogMessageBuilder>);
+    compare("long text", &longText<StreamLogMessageBuilder>, &longText<LogMessageBuilder>);
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
+#include <threadingzeug/Tracer.h>
+
+
+using namespace threadingzeug;
+
+namespace
+{
+
+const int size = 1 << 24;
+const int repetitions = 20;
+const int grain = 1 << 14;
+
+typedef std::function<void(int begin, int end)> Kernel;
+typedef std::function<void(const Kernel & kernel)> Scheduler;
+
+// Round-robin index distribution of the former parallel_for implementation
+void stride(const Kernel & kernel)
+{
+    auto & pool = ThreadPool::instance();
+    const auto numberOfJobs = pool.numberOfThreads() + 1;
+
+    pool.execute(numberOfJobs, [numberOfJobs, &kernel] (unsigned job)
+    {
+        for (auto i = static_cast<int>(job); i < size; i += numberOfJobs)
+            kernel(i, i + 1);
+    });
+}
+
+Scheduler chunked(SchedulingPolicy policy)
+{
+    return [policy] (const Kernel & kernel)
+    {
+        parallel_for(Range<int>(0, size), grain, kernel, policy);
+    };
+}
+
+double measure(const Scheduler & scheduler, const Kernel & kernel)
+{
+    std::vector<double> times;
+
+    for (auto i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        scheduler(kernel);
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+} // namespace
+
+
+// Pass a file name to write a trace of the runs (requires OPTION_THREADINGZEUG_TRACING)
+int main(int argc, char * argv[])
+{
+    std::vector<float> a(size, 0.0f), b(size, 1.0f), c(size, 2.0f);
+    std::vector<int> counters(size, 0);
+
+    const std::vector<std::pair<std::string, Kernel>> kernels = {
+        { "triad", [&a, &b, &c] (int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                    a[i] = b[i] + 3.0f * c[i];
+            } },
+        { "increment", [&counters] (int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                    ++counters[i];
+            } }
+    };
+
+    const std::vector<std::pair<std::string, Scheduler>> schedulers = {
+        { "stride", stride },
+        { "static", chunked(SchedulingPolicy::Static) },
+        { "dynamic", chunked(SchedulingPolicy::Dynamic) },
+        { "guided", chunked(SchedulingPolicy::Guided) }
+    };
+
+    std::cout << size << " elements, " << ThreadPool::instance().numberOfThreads() + 1
+        << " threads, median of " << repetitions << " runs [ms]" << std::endl;
+
+    if (argc > 1)
+        Tracer::start();
+
+    std::cout << std::setw(12) << "";
+    for (const auto & scheduler : schedulers)
+        std::cout << std::setw(10) << scheduler.first;
+    std::cout << std::endl;
+
+    for (const auto & kernel : kernels)
+    {
+        std::cout << std::setw(12) << kernel.first;
+
+        for (const auto & scheduler : schedulers)
+            std::cout << std::setw(10) << std::fixed << std::setprecision(2) << measure(scheduler.second, kernel.second);
+
+        std::cout << std::endl;
+    }
+
+    if (argc > 1)
+    {
+        Tracer::stop();
+
+        if (!Tracer::available())
+            std::cerr << "threadingzeug was built without OPTION_THREADINGZEUG_TRACING" << std::endl;
+        else if (!Tracer::writeChromeTrace(argv[1]))
+            std::cerr << "Could not write " << argv[1] << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/parallelforeach.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+namespace
+{
+
+const std::size_t size = 1 << 24;
+const int repetitions = 20;
+const float dt = 0.01f;
+
+struct Particle
+{
+    float x, y, z;
+    float vx, vy, vz;
+};
+
+double measure(const std::function<void()> & run)
+{
+    std::vector<double> times;
+
+    for (auto i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        run();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+void report(const std::string & name, double perElement, double batched)
+{
+    std::cout << std::setw(12) << name
+        << std::setw(14) << std::fixed << std::setprecision(2) << perElement
+        << std::setw(14) << batched
+        << std::setw(12) << perElement / batched << "x" << std::endl;
+}
+
+} // namespace
+
+
+int main(int /*argc*/, char * /*argv*/[])
+{
+    std::cout << size << " elements, " << ThreadPool::instance().numberOfThreads() + 1
+        << " threads, median of " << repetitions << " runs [ms]" << std::endl;
+
+    std::cout << std::setw(12) << "" << std::setw(14) << "per element" << std::setw(14) << "batched" << std::setw(13) << "speedup" << std::endl;
+
+    // scale a float array in place
+    {
+        auto values = std::vector<float>(size, 1.0f);
+
+        const auto perElement = measure([&values] ()
+        {
+            parallel_for(values, std::function<void(float &)>([] (float & value) { value *= 1.0001f; }));
+        });
+
+        const auto batched = measure([&values] ()
+        {
+            parallel_for_each(values, [] (Span<float> block)
+            {
+                const auto data = block.data();
+                for (auto i = std::size_t(0); i < block.size(); ++i)
+                    data[i] *= 1.0001f;
+            });
+        });
+
+        report("scale", perElement, batched);
+    }
+
+    // integrate particle positions: array of structs per element vs. structure of arrays in blocks
+    {
+        auto particles = std::vector<Particle>(size, Particle{ 0.0f, 0.0f, 0.0f, 1.0f, 2.0f, 3.0f });
+
+        auto x = std::vector<float>(size, 0.0f), y = x, z = x;
+        auto vx = std::vector<float>(size, 1.0f), vy = std::vector<float>(size, 2.0f), vz = std::vector<float>(size, 3.0f);
+
+        const auto perElement = measure([&particles] ()
+        {
+            parallel_for(particles, std::function<void(Particle &)>([] (Particle & particle)
+            {
+                particle.x += particle.vx * dt;
+                particle.y += particle.vy * dt;
+                particle.z += particle.vz * dt;
+            }));
+        });
+
+        const auto view = makeSoAView(x, y, z, vx, vy, vz);
+
+        const auto batched = measure([&view] ()
+        {
+            typedef SoAView<float, float, float, float, float, float> Particles;
+
+            parallel_for_each(view, [] (const Particles & block)
+            {
+                const auto x = block.get<0>().data(), y = block.get<1>().data(), z = block.get<2>().data();
+                const auto vx = block.get<3>().data(), vy = block.get<4>().data(), vz = block.get<5>().data();
+
+                for (auto i = std::size_t(0); i < block.size(); ++i)
+                {
+                    x[i] += vx[i] * dt;
+                    y[i] += vy[i] * dt;
+                    z[i] += vz[i] * dt;
+                }
+            });
+        });
+
+        report("particles", perElement, batched);
+    }
+
+    return 0;
+}
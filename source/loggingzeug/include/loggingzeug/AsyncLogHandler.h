@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <loggingzeug/loggingzeug_api.h>
+#include <loggingzeug/FileLogHandler.h>
+
+namespace loggingzeug
+{
+
+/** \brief Writes LogMessages to a file on a background thread.
+
+    handle() only formats the message into a line and pushes it into a lock-free
+    ring buffer shared by all logging threads. A writer thread keeps the file open
+    and appends all lines pending in the ring with a single write, so logging
+    neither opens the file nor flushes it per message.
+
+    \code{.cpp}
+
+        setLoggingHandler(new AsyncLogHandler("application.log", AsyncLogHandler::DropAndReport));
+
+    \endcode
+
+    Fatal messages are written before handle() returns, as the application may
+    terminate right after logging them. Other messages are written on destruction
+    at the latest; call flush() to wait for them earlier.
+
+    \see FileLogHandler
+    \see setLoggingHandler
+*/
+class LOGGINGZEUG_API AsyncLogHandler : public FileLogHandler
+{
+public:
+    /** What handle() does if the writer thread cannot keep up and the ring is full. */
+    enum OverflowPolicy
+    {
+        Block,          ///< Waits for the writer thread, no message is lost
+        Drop,           ///< Discards the message, see droppedMessages()
+        DropAndReport   ///< Discards the message and writes the number of discarded messages to the log
+    };
+
+public:
+    /**
+     * \param capacity
+     *     Maximum number of pending messages; rounded up to a power of two
+     */
+    AsyncLogHandler(const std::string & logfile = "logfile.log", OverflowPolicy policy = Block, std::size_t capacity = 4096);
+    virtual ~AsyncLogHandler();
+
+    AsyncLogHandler(const AsyncLogHandler &) = delete;
+    AsyncLogHandler & operator=(const AsyncLogHandler &) = delete;
+
+    virtual void handle(const LogMessage & message) override;
+
+    /** Waits until all messages handled before are written to the file. */
+    void flush();
+
+    OverflowPolicy overflowPolicy() const;
+    std::uint64_t droppedMessages() const;
+
+protected:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        std::string line;
+    };
+
+    static const std::size_t s_cacheLineSize = 64;
+
+protected:
+    bool tryPush(std::string & line);
+    bool pending() const;
+
+    void wakeWriter();
+    void write();
+
+protected:
+    OverflowPolicy m_policy;
+    std::ofstream m_stream;
+
+    std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+
+    // logging threads and the writer contend for different cache lines
+    char m_padding0[s_cacheLineSize];
+    std::atomic<std::size_t> m_enqueuePosition;
+    std::atomic<std::uint64_t> m_dropped;
+    char m_padding1[s_cacheLineSize];
+    std::size_t m_dequeuePosition;
+    std::atomic<std::size_t> m_written;
+    char m_padding2[s_cacheLineSize];
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    std::condition_variable m_flushed;
+    std::condition_variable m_notFull;
+    std::atomic<bool> m_writerWaiting;
+    bool m_stop;
+
+    std::thread m_writer;
+};
+
+} // namespace loggingzeug
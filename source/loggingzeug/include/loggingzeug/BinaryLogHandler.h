@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <loggingzeug/loggingzeug_api.h>
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/Format.h>
+#include <loggingzeug/LogMessage.h>
+
+namespace loggingzeug
+{
+
+/** \brief Writes compact binary records of LogMessages into a memory-mapped ring file.
+
+    Instead of formatting text, log() stores a record of the timestamp, the level,
+    the ids of the interned context and formatString format, and the raw bytes of
+    the arguments. The file is mapped into memory, so writing a record is a copy into
+    the mapping; once the ring is full, the oldest records are overwritten.
+    BinaryLogReader and the binarylogdecoder tool turn the records back into the
+    text of ConsoleLogHandler, formatting the arguments as formatString would.
+
+    \code{.cpp}
+
+        auto trace = new BinaryLogHandler("trace.binlog");
+        trace->log(LogMessage::Debug, "render", "Frame %; took %f.2; ms", frame, milliseconds);
+
+    \endcode
+
+    Only log() skips formatting. Messages logged through info(), fInfo(), the
+    LOGGINGZEUG_* statements or a LogRouter reach handle() as LogMessages, whose
+    text the LogMessageBuilder has already formatted; handle() stores that text as a
+    single string argument. Keep a pointer to the handler and call log() for the
+    messages that should be recorded unformatted.
+
+    Contexts and formats are interned by their content once per handler, so they
+    should come from a small set of strings. Arguments of types other than numbers,
+    characters and strings are streamed into text when logged. The file is recreated
+    on construction; it is written in the byte order of the platform.
+
+    \see BinaryLogReader
+    \see setLoggingHandler
+*/
+class LOGGINGZEUG_API BinaryLogHandler : public AbstractLogHandler
+{
+public:
+    /**
+     * \param capacity
+     *     Size of the ring of records in bytes
+     * \param tableCapacity
+     *     Size of the table of interned contexts and formats in bytes
+     */
+    BinaryLogHandler(const std::string & logfile = "logfile.binlog", std::size_t capacity = 16 << 20, std::size_t tableCapacity = 1 << 20);
+    virtual ~BinaryLogHandler();
+
+    BinaryLogHandler(const BinaryLogHandler &) = delete;
+    BinaryLogHandler & operator=(const BinaryLogHandler &) = delete;
+
+    /** Returns whether the file could be created and mapped. */
+    bool isOpen() const;
+
+    virtual void handle(const LogMessage & message) override;
+
+    /** Records a message without formatting it, see formatString for the format. */
+    template <typename... Args>
+    void log(LogMessage::Level level, const std::string & context, const char * format, const Args & ... args);
+
+    /** Messages not recorded since they are larger than a quarter of the ring. */
+    std::uint64_t droppedMessages() const;
+
+protected:
+    // encoded arguments, spilling to the heap only for long strings
+    class Arguments
+    {
+    public:
+        Arguments();
+
+        void append(const void * data, std::size_t size);
+
+        const char * data() const;
+        std::size_t size() const;
+
+    protected:
+        static const std::size_t s_inlineSize = 256;
+
+        std::size_t m_size;
+        std::string m_heap;
+        char m_inline[s_inlineSize];
+    };
+
+protected:
+    template <typename T, typename... Args>
+    static void encode(Arguments & arguments, const T & value, const Args & ... args);
+    static void encode(Arguments & arguments);
+
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::OtherValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::BoolValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::CharacterValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::SignedValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::UnsignedValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::FloatValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::CStringValue>);
+    template <typename T>
+    static void encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::StringValue>);
+
+    static void encodeBool(Arguments & arguments, bool value);
+    static void encodeCharacter(Arguments & arguments, char value);
+    static void encodeInteger(Arguments & arguments, const void * value, std::size_t size, bool isSigned);
+    static void encodeFloat(Arguments & arguments, float value);
+    static void encodeFloat(Arguments & arguments, double value);
+    static void encodeFloat(Arguments & arguments, long double value);
+    static void encodeString(Arguments & arguments, const char * text, std::size_t length);
+
+    void write(bool formatted, LogMessage::Level level, const std::string & context, const char * format, const Arguments & arguments, std::size_t argumentCount);
+
+    // the id of the string in the table, 0 if it is empty or does not fit
+    std::uint32_t intern(const std::string & text);
+    std::uint32_t internFormat(const char * format);
+
+    bool open(std::size_t fileSize);
+    void close();
+
+protected:
+    std::string m_logfile;
+
+    mutable std::mutex m_mutex;
+
+    char * m_memory;
+    std::size_t m_fileSize;
+    // platform specific handles of the file and its mapping
+    std::intptr_t m_file;
+    std::intptr_t m_mapping;
+
+    std::unordered_map<std::string, std::uint32_t> m_ids;
+    // formats are looked up by address first, verified by content
+    std::unordered_map<const char *, std::pair<std::uint32_t, const std::string *>> m_formatIds;
+
+    std::uint64_t m_dropped;
+};
+
+} // namespace loggingzeug
+
+#include <loggingzeug/BinaryLogHandler.hpp>
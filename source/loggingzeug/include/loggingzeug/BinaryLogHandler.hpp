@@ -0,0 +1,80 @@
+#pragma once
+
+#include <loggingzeug/BinaryLogHandler.h>
+
+#include <cstring>
+#include <sstream>
+
+namespace loggingzeug
+{
+
+template <typename... Args>
+void BinaryLogHandler::log(LogMessage::Level level, const std::string & context, const char * format, const Args & ... args)
+{
+    Arguments arguments;
+    encode(arguments, args...);
+
+    write(true, level, context, format, arguments, sizeof...(Args));
+}
+
+template <typename T, typename... Args>
+void BinaryLogHandler::encode(Arguments & arguments, const T & value, const Args & ... args)
+{
+    encodeValue(arguments, value, Format::KindOf<T>());
+    encode(arguments, args...);
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::OtherValue>)
+{
+    std::ostringstream stream;
+    stream << value;
+
+    const auto text = stream.str();
+    encodeString(arguments, text.data(), text.size());
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::BoolValue>)
+{
+    encodeBool(arguments, value);
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::CharacterValue>)
+{
+    encodeCharacter(arguments, static_cast<char>(value));
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::SignedValue>)
+{
+    encodeInteger(arguments, &value, sizeof(T), true);
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::UnsignedValue>)
+{
+    encodeInteger(arguments, &value, sizeof(T), false);
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::FloatValue>)
+{
+    encodeFloat(arguments, value);
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::CStringValue>)
+{
+    const char * text = value;
+    encodeString(arguments, text, std::strlen(text));
+}
+
+template <typename T>
+void BinaryLogHandler::encodeValue(Arguments & arguments, const T & value, Format::Kind<Format::StringValue>)
+{
+    encodeString(arguments, value.data(), value.size());
+}
+
+} // namespace loggingzeug
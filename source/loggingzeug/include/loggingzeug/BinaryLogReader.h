@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <loggingzeug/loggingzeug_api.h>
+#include <loggingzeug/LogMessage.h>
+
+namespace loggingzeug
+{
+
+/** \brief Reads the LogMessages recorded by a BinaryLogHandler.
+
+    The records are read in the order they were written, the arguments of logged
+    formats are formatted as formatString would have formatted them.
+
+    \code{.cpp}
+
+        BinaryLogReader reader("trace.binlog");
+
+        for (const auto & record : reader.records())
+            std::cout << record.message.message() << std::endl;
+
+    \endcode
+
+    \see BinaryLogHandler
+*/
+class LOGGINGZEUG_API BinaryLogReader
+{
+public:
+    struct Record
+    {
+        std::chrono::system_clock::time_point time;
+        LogMessage message;
+    };
+
+public:
+    BinaryLogReader(const std::string & logfile);
+
+    /** Returns whether the file could be read and was written by a BinaryLogHandler. */
+    bool isValid() const;
+
+    const std::vector<Record> & records() const;
+
+protected:
+    bool read(const std::string & logfile);
+
+protected:
+    bool m_valid;
+    std::vector<Record> m_records;
+};
+
+} // namespace loggingzeug
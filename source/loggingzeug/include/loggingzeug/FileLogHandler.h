@@ -21,6 +21,8 @@ public:
 
 protected:
     static std::string messagePrefix(const LogMessage & message);
+    // appends the prefix in place, e.g., to a line reserved for the whole message
+    static void appendMessagePrefix(std::string & text, const LogMessage & message);
     static std::string levelString(LogMessage::Level level);
 
     std::string m_logfile;
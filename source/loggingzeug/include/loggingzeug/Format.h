@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <loggingzeug/loggingzeug_api.h>
+
+namespace loggingzeug
+{
+
+/** \brief A format string of formatString, parsed once and applied any number of times.
+
+    Parsing turns the format into literal text and a list of specifiers, each
+    describing how to format one argument. Applying it appends the text and the
+    formatted arguments to a string directly: numbers, characters, booleans and
+    strings are formatted without streams, only other types are streamed.
+    The output is the same as with formatString.
+
+    The macro LOGGINGZEUG_FORMAT parses a format literal once per call site:
+    \code{.cpp}
+
+        for (auto & node : nodes)
+            fDebug(LOGGINGZEUG_FORMAT("%; at %f.2;, %f.2;"), node.name, node.x, node.y);
+
+    \endcode
+
+    \see formatString
+*/
+class LOGGINGZEUG_API Format
+{
+public:
+    /** \brief The stream formatting of one `%...;` specifier. */
+    struct LOGGINGZEUG_API Specifier
+    {
+        enum Alignment
+        {
+            DefaultAlignment,
+            Left,
+            Right,
+            Internal
+        };
+
+        enum FloatField
+        {
+            General,
+            Fixed,
+            Scientific
+        };
+
+        enum Base
+        {
+            DefaultBase,
+            Decimal,
+            Octal,
+            Hexadecimal
+        };
+
+        Specifier();
+
+        /** Parses a specifier after its '%' and advances format behind its ';'. */
+        static Specifier parse(const char *& format);
+
+        /** Sets the flags of the specifier on the stream, leaving unspecified ones unchanged. */
+        void apply(std::ostream & stream) const;
+
+        Alignment alignment;
+        FloatField floatField;
+        Base base;
+
+        bool boolAlpha;
+        bool showPos;
+        bool showBase;
+        bool upperCase;
+        bool showPoint;
+
+        bool hasFill;
+        char fill;
+        int width;
+        /** Negative if not specified */
+        int precision;
+    };
+
+public:
+    explicit Format(const char * format);
+
+    /** Appends the formatted arguments to output. */
+    template <typename... Args>
+    void appendTo(std::string & output, const Args & ... args) const;
+
+    template <typename... Args>
+    std::string operator()(const Args & ... args) const;
+
+    std::size_t specifierCount() const;
+
+public:
+    /** How arguments of a type are formatted, also used by BinaryLogHandler to encode them. */
+    enum ValueKind
+    {
+        OtherValue,
+        BoolValue,
+        CharacterValue,
+        SignedValue,
+        UnsignedValue,
+        FloatValue,
+        CStringValue,
+        StringValue
+    };
+
+    template <typename T>
+    struct KindOf;
+
+    template <ValueKind kind>
+    using Kind = std::integral_constant<ValueKind, kind>;
+
+protected:
+    struct Segment
+    {
+        // literal text before the specifier, without escapes
+        std::size_t textBegin;
+        std::size_t textLength;
+
+        Specifier specifier;
+
+        // end of the specifier in the format
+        std::size_t formatEnd;
+    };
+
+protected:
+    template <typename T, typename... Args>
+    void appendValues(std::string & output, std::size_t index, const T & value, const Args & ... args) const;
+    void appendValues(std::string & output, std::size_t index) const;
+
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<OtherValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<BoolValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<CharacterValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<SignedValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<UnsignedValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<FloatValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<CStringValue>);
+    template <typename T>
+    static void appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<StringValue>);
+
+    static void appendInteger(std::string & output, const Specifier & specifier, unsigned long long magnitude, bool negative, bool isSigned);
+    static void appendFloat(std::string & output, const Specifier & specifier, double value);
+    static void appendFloat(std::string & output, const Specifier & specifier, long double value);
+    static void appendText(std::string & output, const Specifier & specifier, const char * text, std::size_t length);
+    static void appendPadded(std::string & output, const Specifier & specifier, const char * prefix, std::size_t prefixLength, const char * body, std::size_t bodyLength);
+
+protected:
+    std::string m_format;
+    std::string m_text;
+    std::vector<Segment> m_segments;
+    // literal text behind the last specifier
+    std::size_t m_trailingBegin;
+};
+
+} // namespace loggingzeug
+
+/**
+ * Parses a format literal into a Format on first use and returns it on every later use.
+ */
+#define LOGGINGZEUG_FORMAT(format) \
+    ([] () -> const loggingzeug::Format & { static const loggingzeug::Format parsed(format); return parsed; }())
+
+#include <loggingzeug/Format.hpp>
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <loggingzeug/Format.h>
+
+#include <cstring>
+#include <sstream>
+
+namespace loggingzeug
+{
+
+template <typename T>
+struct Format::KindOf : Format::Kind<
+    std::is_same<T, bool>::value ? BoolValue :
+    std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value ? CharacterValue :
+    std::is_integral<T>::value && std::is_signed<T>::value ? SignedValue :
+    std::is_integral<T>::value ? UnsignedValue :
+    std::is_floating_point<T>::value ? FloatValue :
+    std::is_convertible<const T &, const char *>::value ? CStringValue :
+    std::is_same<T, std::string>::value ? StringValue :
+    OtherValue>
+{
+};
+
+template <typename... Args>
+void Format::appendTo(std::string & output, const Args & ... args) const
+{
+    appendValues(output, 0, args...);
+}
+
+template <typename... Args>
+std::string Format::operator()(const Args & ... args) const
+{
+    std::string output;
+    appendTo(output, args...);
+    return output;
+}
+
+template <typename T, typename... Args>
+void Format::appendValues(std::string & output, std::size_t index, const T & value, const Args & ... args) const
+{
+    // like formatString, surplus arguments are ignored
+    if (index == m_segments.size())
+    {
+        output.append(m_text, m_trailingBegin, std::string::npos);
+        return;
+    }
+
+    const auto & segment = m_segments[index];
+
+    output.append(m_text, segment.textBegin, segment.textLength);
+    appendValue(output, segment.specifier, value, KindOf<T>());
+
+    appendValues(output, index + 1, args...);
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<OtherValue>)
+{
+    std::ostringstream stream;
+    specifier.apply(stream);
+
+    stream << value;
+    output += stream.str();
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<BoolValue>)
+{
+    if (specifier.boolAlpha)
+        appendText(output, specifier, value ? "true" : "false", value ? 4 : 5);
+    else
+        appendInteger(output, specifier, value ? 1 : 0, false, true);
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<CharacterValue>)
+{
+    const auto character = static_cast<char>(value);
+    appendText(output, specifier, &character, 1);
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<SignedValue>)
+{
+    // other bases show the bits of negative values, as streams do
+    const auto bits = static_cast<unsigned long long>(static_cast<typename std::make_unsigned<T>::type>(value));
+    const auto negative = value < 0 && specifier.base != Specifier::Octal && specifier.base != Specifier::Hexadecimal;
+
+    appendInteger(output, specifier, negative ? 0ull - static_cast<unsigned long long>(value) : bits, negative, true);
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<UnsignedValue>)
+{
+    appendInteger(output, specifier, value, false, false);
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<FloatValue>)
+{
+    using Float = typename std::conditional<std::is_same<T, long double>::value, long double, double>::type;
+    appendFloat(output, specifier, static_cast<Float>(value));
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<CStringValue>)
+{
+    const char * text = value;
+    appendText(output, specifier, text, std::strlen(text));
+}
+
+template <typename T>
+void Format::appendValue(std::string & output, const Specifier & specifier, const T & value, Kind<StringValue>)
+{
+    appendText(output, specifier, value.data(), value.size());
+}
+
+} // namespace loggingzeug
@@ -28,6 +28,7 @@ public:
 	};
 
 	LogMessage(Level level, const std::string& message, const std::string& context);
+	LogMessage(Level level, std::string&& message, std::string&& context);
 
 	Level level() const;
 	const std::string& message() const;
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <sstream>
+#include <cstddef>
+#include <ostream>
 #include <string>
 #include <vector>
 #include <array>
@@ -31,6 +32,11 @@ class AbstractLogHandler;
 	
     \endcode
 
+    Messages are formatted into a buffer inside the builder, which spills to the heap
+    only for messages longer than s_inlineSize characters. Numbers are formatted like
+    the corresponding stream output, honoring setprecision, setw and setfill. The
+    finished message is moved into the LogMessage passed to the handler.
+
 	\see logging.h
 	\see LogMessage
 	\see setLoggingHandler
@@ -49,9 +55,13 @@ public:
     using WidthManipulator = decltype(std::setw(0));
 public:
     LogMessageBuilder(LogMessage::Level level, AbstractLogHandler * handler, const std::string & context);
-    LogMessageBuilder(const LogMessageBuilder & builder);
+    /** Takes over the message; only the builder moved to last sends it. */
+    LogMessageBuilder(LogMessageBuilder && builder);
 	virtual ~LogMessageBuilder();
 
+    LogMessageBuilder(const LogMessageBuilder &) = delete;
+    LogMessageBuilder & operator=(const LogMessageBuilder &) = delete;
+
     LogMessageBuilder & operator<<(const char * c);
     LogMessageBuilder & operator<<(const std::string & str);
     LogMessageBuilder & operator<<(bool b);
@@ -86,11 +96,34 @@ public:
     LogMessageBuilder & operator<<(const std::vector<T> & vector);
     template <typename T, std::size_t Count>
     LogMessageBuilder & operator<<(const std::array<T, Count> & array);
+protected:
+    static const std::size_t s_inlineSize = 256;
+
+protected:
+    void append(const char * characters, std::size_t count);
+    // appends a formatted value, padded to the pending width
+    void appendField(const char * characters, std::size_t count);
+    void reserve(std::size_t count);
+
+    template <typename Unsigned>
+    void appendInteger(Unsigned value, bool negative);
+    template <typename Float>
+    void appendFloat(Float value, const char * format);
+
 protected:
 	LogMessage::Level m_level;
     AbstractLogHandler * m_handler;
     std::string m_context;
-    std::shared_ptr<std::stringstream> m_stream;
+
+    int m_precision;
+    int m_width;
+    char m_fill;
+
+    char * m_data;
+    std::size_t m_size;
+    std::size_t m_capacity;
+    std::unique_ptr<char[]> m_heap;
+    char m_inline[s_inlineSize];
 };
 
 } // namespace loggingzeug
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <loggingzeug/loggingzeug_api.h>
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/LogMessage.h>
+
+namespace loggingzeug
+{
+
+/** \brief Passes each LogMessage on to several handlers, the sinks.
+
+    Each sink has a maximum level and optionally a set of contexts it accepts or
+    rejects. The message is formatted once by the LogMessageBuilder and handed to
+    every sink whose filters it passes. Which sinks accept a context, and up to
+    which level, is determined once per context string and cached per thread.
+
+    \code{.cpp}
+
+        auto router = new LogRouter();
+
+        router->addSink(new ConsoleLogHandler(), LogMessage::Warning);
+        router->addSink(new AsyncLogHandler("application.log"));
+
+        const auto trace = router->addSink(new BinaryLogHandler("trace.binlog"), LogMessage::Debug);
+        router->includeContext(trace, "render");
+
+        setVerbosityLevel(router->maxLevel());
+        setLoggingHandler(router);
+
+    \endcode
+
+    The sinks only receive formatted LogMessages. The BinaryLogHandler above thus
+    records the text of each "render" message, not its format and arguments; use
+    BinaryLogHandler::log() directly to record those unformatted.
+
+    The router owns its sinks. Sinks and filters have to be configured before the
+    router receives messages; handle() itself may be called from any thread.
+
+    \see setLoggingHandler
+*/
+class LOGGINGZEUG_API LogRouter : public AbstractLogHandler
+{
+public:
+    LogRouter();
+    virtual ~LogRouter();
+
+    LogRouter(const LogRouter &) = delete;
+    LogRouter & operator=(const LogRouter &) = delete;
+
+    /** Takes ownership of the handler and returns the index of the sink. */
+    std::size_t addSink(AbstractLogHandler * handler, LogMessage::Level maxLevel = LogMessage::Info);
+    std::size_t sinkCount() const;
+    AbstractLogHandler * sink(std::size_t index) const;
+
+    void setMaxLevel(std::size_t sink, LogMessage::Level maxLevel);
+
+    /** Once a context is included, the sink only accepts messages of included contexts. */
+    void includeContext(std::size_t sink, const std::string & context);
+    /** The sink rejects messages of excluded contexts. */
+    void excludeContext(std::size_t sink, const std::string & context);
+
+    /** The most verbose level any sink accepts, e.g., for setVerbosityLevel. */
+    LogMessage::Level maxLevel() const;
+
+    virtual void handle(const LogMessage & message) override;
+
+protected:
+    struct Sink
+    {
+        std::unique_ptr<AbstractLogHandler> handler;
+        LogMessage::Level maxLevel;
+        std::set<std::string> included;
+        std::set<std::string> excluded;
+    };
+
+    // per sink the most verbose level accepted for a context, -1 if the context is rejected
+    using Decision = std::vector<int>;
+
+    const Decision & decision(const std::string & context);
+    void clearDecisions();
+
+protected:
+    std::vector<Sink> m_sinks;
+
+    // identifies the router's decisions in the per-thread caches
+    const std::uint64_t m_id;
+    // changes whenever the sinks are reconfigured, invalidating the cached decisions
+    std::atomic<std::uint64_t> m_generation;
+
+    std::mutex m_mutex;
+};
+
+} // namespace loggingzeug
@@ -4,6 +4,7 @@
 #include <string>
 
 #include <loggingzeug/loggingzeug_api.h>
+#include <loggingzeug/Format.h>
 
 namespace loggingzeug
 {
@@ -80,6 +81,15 @@ void streamprintf(std::ostream& stream, const char* format, const T& value, Args
 template <typename... Args>
 std::string formatString(const char* format, Args... args);
 
+/**
+ * Same as formatString, with the format parsed in advance.
+ *
+ * \see Format
+ * \see LOGGINGZEUG_FORMAT
+ */
+template <typename... Args>
+std::string formatString(const Format & format, Args... args);
+
 } // namespace loggingzeug
 
 #include <loggingzeug/formatString.hpp>
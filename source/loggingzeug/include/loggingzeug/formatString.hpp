@@ -39,4 +39,10 @@ std::string formatString(const char* format, Args... args)
 	return ss.str();
 }
 
+template <typename... Args>
+std::string formatString(const Format & format, Args... args)
+{
+    return format(args...);
+}
+
 } // namespace loggingzeug
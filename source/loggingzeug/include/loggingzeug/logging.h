@@ -4,6 +4,15 @@
 
 #include <loggingzeug/LogMessage.h>
 #include <loggingzeug/LogMessageBuilder.h>
+#include <loggingzeug/Format.h>
+
+/**
+ * Messages more verbose than this level are removed at compile time from the
+ * LOGGINGZEUG_* log statements, e.g., -DLOGGINGZEUG_MAX_LEVEL=Warning.
+ */
+#ifndef LOGGINGZEUG_MAX_LEVEL
+#define LOGGINGZEUG_MAX_LEVEL Info
+#endif
 
 namespace loggingzeug
 {
@@ -32,6 +41,12 @@ LOGGINGZEUG_API AbstractLogHandler * loggingHandler();
 LOGGINGZEUG_API void setVerbosityLevel(LogMessage::Level verbosity);
 LOGGINGZEUG_API LogMessage::Level verbosityLevel();
 
+/**
+  * Returns whether messages of the level are passed to a logging handler at all,
+  * i.e., whether the level does not exceed the verbosity level and a handler is set.
+  */
+LOGGINGZEUG_API bool isEnabled(LogMessage::Level level);
+
 /**
  * Uses formatString to write on the usual logging streams.
  *
@@ -46,30 +61,114 @@ LOGGINGZEUG_API LogMessage::Level verbosityLevel();
 template <typename... Arguments>
 void fInfo(const char* format, Arguments... arguments);
 
+/**
+ * Uses a Format parsed in advance, e.g., once per call site with LOGGINGZEUG_FORMAT:
+ *
+ *  \code{.cpp}
+ *      fInfo(LOGGINGZEUG_FORMAT("Frame %; took %f.2; ms"), frame, milliseconds);
+ *  \endcode
+ *
+ *   \see Format
+ */
+template <typename... Arguments>
+void fInfo(const Format & format, Arguments... arguments);
+
 /**
  *  \see fInfo
  */
 template <typename... Arguments>
 void fDebug(const char* format, Arguments... arguments);
+template <typename... Arguments>
+void fDebug(const Format & format, Arguments... arguments);
 
 /**
  *  \see fInfo
  */
 template <typename... Arguments>
 void fWarning(const char* format, Arguments... arguments);
+template <typename... Arguments>
+void fWarning(const Format & format, Arguments... arguments);
 
 /**
  *  \see fInfo
  */
 template <typename... Arguments>
 void fCritical(const char* format, Arguments... arguments);
+template <typename... Arguments>
+void fCritical(const Format & format, Arguments... arguments);
 
 /**
  *  \see fInfo
  */
 template <typename... Arguments>
 void fFatal(const char* format, Arguments... arguments);
+template <typename... Arguments>
+void fFatal(const Format & format, Arguments... arguments);
+
+/**
+ * The context of log statements without a context of their own. Its maximum level is
+ * LOGGINGZEUG_MAX_LEVEL, which defaults to Info (i.e., all messages are compiled in).
+ *
+ * \see LOGGINGZEUG_CONTEXT
+ */
+struct GlobalContext
+{
+    static const char * name()
+    {
+        return "";
+    }
+
+    static const LogMessage::Level maxLevel = LogMessage::LOGGINGZEUG_MAX_LEVEL;
+};
 
 } // namespace loggingzeug
 
+/**
+ * Declares a context for the LOGGINGZEUG_* log statements. Statements in this context with
+ * a level more verbose than maxLevel (or LOGGINGZEUG_MAX_LEVEL) are removed at compile time.
+ *
+ *  Sample usage:
+ *  \code{.cpp}
+ *      #ifdef NDEBUG
+ *          LOGGINGZEUG_CONTEXT(RenderLog, "render", Warning);
+ *      #else
+ *          LOGGINGZEUG_CONTEXT(RenderLog, "render", Info);
+ *      #endif
+ *
+ *      LOGGINGZEUG_DEBUG(RenderLog) << "Frame " << frame << " took " << elapsed() << " ms";
+ *  \endcode
+ */
+#define LOGGINGZEUG_CONTEXT(Context, contextName, contextMaxLevel) \
+    struct Context \
+    { \
+        static const char * name() \
+        { \
+            return contextName; \
+        } \
+ \
+        static const loggingzeug::LogMessage::Level maxLevel = \
+            loggingzeug::LogMessage::contextMaxLevel < loggingzeug::GlobalContext::maxLevel \
+                ? loggingzeug::LogMessage::contextMaxLevel : loggingzeug::GlobalContext::maxLevel; \
+    }
+
+/**
+ * Log statements that check the level before anything is built: if the message would be
+ * discarded, neither a LogMessageBuilder is created nor the streamed arguments are evaluated.
+ * Unlike info() and friends, they take a context declared with LOGGINGZEUG_CONTEXT (or
+ * loggingzeug::GlobalContext) instead of a string.
+ *
+ *  \code{.cpp}
+ *      LOGGINGZEUG_WARNING(loggingzeug::GlobalContext) << "Shader " << name << " failed: " << log();
+ *  \endcode
+ */
+#define LOGGINGZEUG_LOG(Context, level) \
+    if (!(loggingzeug::LogMessage::level <= Context::maxLevel && loggingzeug::isEnabled(loggingzeug::LogMessage::level))) {} else \
+        loggingzeug::info(Context::name(), loggingzeug::LogMessage::level)
+
+#define LOGGINGZEUG_INFO(Context) LOGGINGZEUG_LOG(Context, Info)
+#define LOGGINGZEUG_DEBUG(Context) LOGGINGZEUG_LOG(Context, Debug)
+#define LOGGINGZEUG_WARNING(Context) LOGGINGZEUG_LOG(Context, Warning)
+#define LOGGINGZEUG_CRITICAL(Context) LOGGINGZEUG_LOG(Context, Critical)
+#define LOGGINGZEUG_FATAL(Context) LOGGINGZEUG_LOG(Context, Fatal)
+
 #include <loggingzeug/logging.hpp>
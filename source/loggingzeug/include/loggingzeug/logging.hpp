@@ -13,35 +13,90 @@ template <typename... Arguments> void fInfo(const char* format, Arguments... arg
 {
     assert(format != nullptr);
 
+    if (!isEnabled(LogMessage::Info))
+        return;
+
     info() << formatString(format, arguments...);
 }
 
+template <typename... Arguments> void fInfo(const Format & format, Arguments... arguments)
+{
+    if (!isEnabled(LogMessage::Info))
+        return;
+
+    info() << format(arguments...);
+}
+
 template <typename... Arguments> void fDebug(const char* format, Arguments... arguments)
 {
     assert(format != nullptr);
 
+    if (!isEnabled(LogMessage::Debug))
+        return;
+
     debug() << formatString(format, arguments...);
 }
 
+template <typename... Arguments> void fDebug(const Format & format, Arguments... arguments)
+{
+    if (!isEnabled(LogMessage::Debug))
+        return;
+
+    debug() << format(arguments...);
+}
+
 template <typename... Arguments> void fWarning(const char* format, Arguments... arguments)
 {
     assert(format != nullptr);
 
+    if (!isEnabled(LogMessage::Warning))
+        return;
+
     warning() << formatString(format, arguments...);
 }
 
+template <typename... Arguments> void fWarning(const Format & format, Arguments... arguments)
+{
+    if (!isEnabled(LogMessage::Warning))
+        return;
+
+    warning() << format(arguments...);
+}
+
 template <typename... Arguments> void fCritical(const char* format, Arguments... arguments)
 {
     assert(format != nullptr);
 
+    if (!isEnabled(LogMessage::Critical))
+        return;
+
     critical() << formatString(format, arguments...);
 }
 
+template <typename... Arguments> void fCritical(const Format & format, Arguments... arguments)
+{
+    if (!isEnabled(LogMessage::Critical))
+        return;
+
+    critical() << format(arguments...);
+}
+
 template <typename... Arguments> void fFatal(const char* format, Arguments... arguments)
 {
     assert(format != nullptr);
 
+    if (!isEnabled(LogMessage::Fatal))
+        return;
+
     fatal() << formatString(format, arguments...);
 }
 
+template <typename... Arguments> void fFatal(const Format & format, Arguments... arguments)
+{
+    if (!isEnabled(LogMessage::Fatal))
+        return;
+
+    fatal() << format(arguments...);
+}
+
 } // namespace loggingzeug
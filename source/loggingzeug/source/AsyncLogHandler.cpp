@@ -0,0 +1,216 @@
+#include <loggingzeug/AsyncLogHandler.h>
+
+#include <utility>
+
+namespace
+{
+    // lines are appended to the file in writes of about this size
+    const std::size_t batchSize = 64 * 1024;
+}
+
+namespace loggingzeug
+{
+
+AsyncLogHandler::AsyncLogHandler(const std::string & logfile, OverflowPolicy policy, std::size_t capacity)
+: FileLogHandler(logfile)
+, m_policy(policy)
+, m_stream(logfile, std::ios_base::out | std::ios_base::app)
+, m_mask(0)
+, m_enqueuePosition(0)
+, m_dropped(0)
+, m_dequeuePosition(0)
+, m_written(0)
+, m_writerWaiting(false)
+, m_stop(false)
+{
+    auto size = std::size_t(2);
+    while (size < capacity)
+        size *= 2;
+
+    m_mask = size - 1;
+    m_cells.reset(new Cell[size]);
+
+    // a cell is free for the line at position i while its sequence is i
+    for (auto i = std::size_t(0); i < size; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+
+    m_writer = std::thread(&AsyncLogHandler::write, this);
+}
+
+AsyncLogHandler::~AsyncLogHandler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_wakeUp.notify_one();
+    m_writer.join();
+}
+
+void AsyncLogHandler::handle(const LogMessage & message)
+{
+    // room for the longest level, so the prefix does not reallocate the line
+    std::string line;
+    line.reserve(message.context().size() + message.message().size() + 16);
+
+    appendMessagePrefix(line, message);
+    line += message.message();
+    line += '\n';
+
+    if (!tryPush(line))
+    {
+        if (m_policy != Block)
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // the writer notifies m_notFull under the mutex after freeing cells, so no wake-up is missed
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_wakeUp.notify_one();
+        m_notFull.wait(lock, [this, &line] () { return tryPush(line); });
+    }
+
+    // only the first line after the writer went to sleep wakes it
+    if (m_writerWaiting.load(std::memory_order_seq_cst) && m_writerWaiting.exchange(false))
+        wakeWriter();
+
+    if (message.level() == LogMessage::Fatal)
+        flush();
+}
+
+void AsyncLogHandler::flush()
+{
+    const auto position = m_enqueuePosition.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_wakeUp.notify_one();
+    m_flushed.wait(lock, [this, position] () { return m_written.load(std::memory_order_acquire) >= position; });
+}
+
+AsyncLogHandler::OverflowPolicy AsyncLogHandler::overflowPolicy() const
+{
+    return m_policy;
+}
+
+std::uint64_t AsyncLogHandler::droppedMessages() const
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+bool AsyncLogHandler::tryPush(std::string & line)
+{
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto & cell = m_cells[position & m_mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell.line = std::move(line);
+                // sequentially consistent with m_writerWaiting, so that either the writer sees the line before sleeping or we see it sleeping
+                cell.sequence.store(position + 1, std::memory_order_seq_cst);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the cell still holds a line of the previous lap
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogHandler::pending() const
+{
+    const auto & cell = m_cells[m_dequeuePosition & m_mask];
+    return cell.sequence.load(std::memory_order_seq_cst) == m_dequeuePosition + 1;
+}
+
+void AsyncLogHandler::wakeWriter()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_wakeUp.notify_one();
+}
+
+void AsyncLogHandler::write()
+{
+    const auto droppedPrefix = messagePrefix(LogMessage(LogMessage::Warning, "", "loggingzeug"));
+
+    std::string batch;
+    batch.reserve(batchSize);
+
+    auto reported = std::uint64_t(0);
+
+    while (true)
+    {
+        auto count = std::size_t(0);
+
+        while (batch.size() < batchSize && pending())
+        {
+            auto & cell = m_cells[m_dequeuePosition & m_mask];
+
+            batch += cell.line;
+            cell.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+
+            ++m_dequeuePosition;
+            ++count;
+        }
+
+        if (m_policy == DropAndReport)
+        {
+            const auto dropped = m_dropped.load(std::memory_order_relaxed);
+
+            if (dropped != reported)
+            {
+                batch += droppedPrefix + std::to_string(dropped - reported) + " messages dropped\n";
+                reported = dropped;
+            }
+        }
+
+        if (!batch.empty())
+        {
+            m_stream.write(batch.data(), batch.size());
+            m_stream.flush();
+            batch.clear();
+        }
+
+        if (count > 0)
+        {
+            m_written.fetch_add(count, std::memory_order_release);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+            }
+            m_flushed.notify_all();
+            m_notFull.notify_all();
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_stop)
+            break;
+
+        m_writerWaiting.store(true, std::memory_order_seq_cst);
+
+        m_wakeUp.wait(lock, [this] () { return m_stop || pending(); });
+
+        m_writerWaiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace loggingzeug
@@ -0,0 +1,160 @@
+#include "BinaryLogFormat.h"
+
+#include <cstring>
+#include <sstream>
+
+#include <loggingzeug/formatString.h>
+
+namespace
+{
+
+using namespace loggingzeug::binarylog;
+
+class ArgumentCursor
+{
+public:
+    ArgumentCursor(const char * data, std::size_t size)
+    : m_data(data)
+    , m_end(data + size)
+    {
+    }
+
+    template <typename T>
+    bool read(T & value)
+    {
+        if (static_cast<std::size_t>(m_end - m_data) < sizeof(T))
+            return false;
+
+        std::memcpy(&value, m_data, sizeof(T));
+        m_data += sizeof(T);
+        return true;
+    }
+
+    bool read(std::string & text)
+    {
+        std::uint32_t length;
+
+        if (!read(length) || static_cast<std::size_t>(m_end - m_data) < length)
+            return false;
+
+        text.assign(m_data, length);
+        m_data += length;
+        return true;
+    }
+
+protected:
+    const char * m_data;
+    const char * m_end;
+};
+
+template <typename T>
+bool stream(std::ostream & stream, ArgumentCursor & cursor)
+{
+    T value;
+
+    if (!cursor.read(value))
+        return false;
+
+    stream << value;
+    return true;
+}
+
+bool streamArgument(std::ostream & out, ArgumentCursor & cursor)
+{
+    std::uint8_t type;
+
+    if (!cursor.read(type))
+        return false;
+
+    switch (type)
+    {
+    case Bool:
+        {
+            std::uint8_t value;
+            if (!cursor.read(value))
+                return false;
+
+            out << (value != 0);
+            return true;
+        }
+    case Character:
+        return stream<char>(out, cursor);
+    case Int16:
+        return stream<std::int16_t>(out, cursor);
+    case Int32:
+        return stream<std::int32_t>(out, cursor);
+    case Int64:
+        return stream<std::int64_t>(out, cursor);
+    case UInt16:
+        return stream<std::uint16_t>(out, cursor);
+    case UInt32:
+        return stream<std::uint32_t>(out, cursor);
+    case UInt64:
+        return stream<std::uint64_t>(out, cursor);
+    case Float:
+        return stream<float>(out, cursor);
+    case Double:
+        return stream<double>(out, cursor);
+    case LongDouble:
+        return stream<long double>(out, cursor);
+    case String:
+        return stream<std::string>(out, cursor);
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+namespace loggingzeug
+{
+
+namespace binarylog
+{
+
+std::string formatArguments(const std::string & format, const char * arguments, std::size_t size, std::size_t count)
+{
+    std::ostringstream stream;
+    ArgumentCursor cursor(arguments, size);
+
+    // the same traversal as streamprintf
+    auto current = format.c_str();
+
+    if (count == 0)
+    {
+        stream << current;
+        return stream.str();
+    }
+
+    auto index = std::size_t(0);
+
+    while (*current)
+    {
+        if (*current == '%' && *++current != '%')
+        {
+            const auto flags = stream.flags();
+            parseFormat(stream, current);
+
+            if (!streamArgument(stream, cursor))
+                break;
+
+            stream.flags(flags);
+
+            if (++index == count)
+            {
+                stream << current;
+                break;
+            }
+        }
+        else
+        {
+            stream << *current++;
+        }
+    }
+
+    return stream.str();
+}
+
+} // namespace binarylog
+
+} // namespace loggingzeug
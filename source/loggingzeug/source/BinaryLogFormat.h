@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace loggingzeug
+{
+
+/*  Layout of files written by BinaryLogHandler and read by BinaryLogReader:
+
+    FileHeader | string table (tableCapacity bytes) | ring (ringCapacity bytes)
+
+    The string table holds the interned contexts and formats, each as a 32 bit length
+    followed by its characters, padded to 4 bytes. Their ids are their indices + 1,
+    id 0 denotes the empty string.
+
+    The ring holds the records between the positions tail and head, which count all
+    bytes ever written; a position maps to the offset position % ringCapacity. A
+    record never wraps: the end of the ring is filled with a Skip record instead.
+*/
+namespace binarylog
+{
+
+const char magic[8] = { 'l', 'z', 'b', 'i', 'n', 'l', 'o', 'g' };
+const std::uint32_t version = 1;
+
+// records and the ring are aligned to this
+const std::uint32_t alignment = 8;
+
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+
+    std::uint64_t tableCapacity;
+    std::uint64_t tableSize;
+    std::uint64_t ringCapacity;
+
+    std::uint64_t head;
+    std::uint64_t tail;
+
+    std::uint32_t stringCount;
+    std::uint32_t reserved;
+};
+
+enum RecordKind : std::uint8_t
+{
+    Skip,       // fills the end of the ring
+    Text,       // a formatted message, as a single String argument
+    Formatted   // a format id and its arguments
+};
+
+struct RecordHeader
+{
+    std::uint32_t size;
+    RecordKind kind;
+    std::uint8_t level;
+    std::uint16_t argumentCount;
+
+    std::uint32_t contextId;
+    std::uint32_t formatId;
+
+    // nanoseconds since the epoch of std::chrono::system_clock
+    std::uint64_t timestamp;
+};
+
+// each argument is its type followed by its value, strings as 32 bit length and characters
+enum ArgumentType : std::uint8_t
+{
+    Bool,
+    Character,
+    Int16,
+    Int32,
+    Int64,
+    UInt16,
+    UInt32,
+    UInt64,
+    Float,
+    Double,
+    LongDouble,
+    String
+};
+
+/*  Formats the encoded arguments as formatString would format the original ones;
+    stops at the first argument that is not encoded completely.
+*/
+std::string formatArguments(const std::string & format, const char * arguments, std::size_t size, std::size_t count);
+
+inline std::uint64_t aligned(std::uint64_t size, std::uint64_t to = alignment)
+{
+    return (size + to - 1) / to * to;
+}
+
+} // namespace binarylog
+
+} // namespace loggingzeug
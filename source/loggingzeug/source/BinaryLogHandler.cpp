@@ -0,0 +1,404 @@
+#include <loggingzeug/BinaryLogHandler.h>
+
+#include <chrono>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "BinaryLogFormat.h"
+
+namespace
+{
+
+using namespace loggingzeug::binarylog;
+
+FileHeader & fileHeader(char * memory)
+{
+    return *reinterpret_cast<FileHeader *>(memory);
+}
+
+template <typename Arguments, typename T>
+void appendValue(Arguments & arguments, ArgumentType type, const T & value)
+{
+    char encoded[1 + sizeof(T)];
+    encoded[0] = static_cast<char>(type);
+    std::memcpy(encoded + 1, &value, sizeof(T));
+
+    arguments.append(encoded, sizeof(encoded));
+}
+
+std::uint64_t timestamp()
+{
+    const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch).count());
+}
+
+} // namespace
+
+namespace loggingzeug
+{
+
+BinaryLogHandler::Arguments::Arguments()
+: m_size(0)
+{
+}
+
+void BinaryLogHandler::Arguments::append(const void * data, std::size_t size)
+{
+    if (m_heap.empty() && m_size + size <= s_inlineSize)
+    {
+        std::memcpy(m_inline + m_size, data, size);
+        m_size += size;
+        return;
+    }
+
+    if (m_heap.empty())
+        m_heap.assign(m_inline, m_size);
+
+    m_heap.append(static_cast<const char *>(data), size);
+    m_size += size;
+}
+
+const char * BinaryLogHandler::Arguments::data() const
+{
+    return m_heap.empty() ? m_inline : m_heap.data();
+}
+
+std::size_t BinaryLogHandler::Arguments::size() const
+{
+    return m_size;
+}
+
+BinaryLogHandler::BinaryLogHandler(const std::string & logfile, std::size_t capacity, std::size_t tableCapacity)
+: m_logfile(logfile)
+, m_memory(nullptr)
+, m_fileSize(0)
+, m_file(-1)
+, m_mapping(-1)
+, m_dropped(0)
+{
+    const auto ringCapacity = aligned(capacity);
+    const auto alignedTableCapacity = aligned(tableCapacity);
+    const auto headerSize = aligned(sizeof(FileHeader));
+
+    if (ringCapacity == 0 || !open(static_cast<std::size_t>(headerSize + alignedTableCapacity + ringCapacity)))
+        return;
+
+    auto & header = fileHeader(m_memory);
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.headerSize = static_cast<std::uint32_t>(headerSize);
+    header.tableCapacity = alignedTableCapacity;
+    header.tableSize = 0;
+    header.ringCapacity = ringCapacity;
+    header.head = 0;
+    header.tail = 0;
+    header.stringCount = 0;
+    header.reserved = 0;
+}
+
+BinaryLogHandler::~BinaryLogHandler()
+{
+    close();
+}
+
+bool BinaryLogHandler::isOpen() const
+{
+    return m_memory != nullptr;
+}
+
+void BinaryLogHandler::handle(const LogMessage & message)
+{
+    Arguments arguments;
+    encodeString(arguments, message.message().data(), message.message().size());
+
+    write(false, message.level(), message.context(), nullptr, arguments, 1);
+}
+
+std::uint64_t BinaryLogHandler::droppedMessages() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dropped;
+}
+
+void BinaryLogHandler::encode(Arguments &)
+{
+}
+
+void BinaryLogHandler::encodeBool(Arguments & arguments, bool value)
+{
+    appendValue(arguments, Bool, static_cast<std::uint8_t>(value));
+}
+
+void BinaryLogHandler::encodeCharacter(Arguments & arguments, char value)
+{
+    appendValue(arguments, Character, value);
+}
+
+void BinaryLogHandler::encodeInteger(Arguments & arguments, const void * value, std::size_t size, bool isSigned)
+{
+    // widened to the next encoded size, keeping the value
+    switch (size)
+    {
+    case 1:
+    case 2:
+        if (isSigned)
+        {
+            std::int16_t widened = size == 1 ? *static_cast<const signed char *>(value) : *static_cast<const std::int16_t *>(value);
+            appendValue(arguments, Int16, widened);
+        }
+        else
+        {
+            std::uint16_t widened = size == 1 ? *static_cast<const unsigned char *>(value) : *static_cast<const std::uint16_t *>(value);
+            appendValue(arguments, UInt16, widened);
+        }
+        break;
+    case 4:
+        if (isSigned)
+            appendValue(arguments, Int32, *static_cast<const std::int32_t *>(value));
+        else
+            appendValue(arguments, UInt32, *static_cast<const std::uint32_t *>(value));
+        break;
+    default:
+        if (isSigned)
+            appendValue(arguments, Int64, *static_cast<const std::int64_t *>(value));
+        else
+            appendValue(arguments, UInt64, *static_cast<const std::uint64_t *>(value));
+        break;
+    }
+}
+
+void BinaryLogHandler::encodeFloat(Arguments & arguments, float value)
+{
+    appendValue(arguments, Float, value);
+}
+
+void BinaryLogHandler::encodeFloat(Arguments & arguments, double value)
+{
+    appendValue(arguments, Double, value);
+}
+
+void BinaryLogHandler::encodeFloat(Arguments & arguments, long double value)
+{
+    appendValue(arguments, LongDouble, value);
+}
+
+void BinaryLogHandler::encodeString(Arguments & arguments, const char * text, std::size_t length)
+{
+    const auto type = static_cast<char>(String);
+    const auto encodedLength = static_cast<std::uint32_t>(length);
+
+    arguments.append(&type, 1);
+    arguments.append(&encodedLength, sizeof(encodedLength));
+    arguments.append(text, encodedLength);
+}
+
+void BinaryLogHandler::write(bool formatted, LogMessage::Level level, const std::string & context, const char * format, const Arguments & arguments, std::size_t argumentCount)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_memory)
+        return;
+
+    RecordHeader record;
+    record.kind = formatted ? Formatted : Text;
+    record.level = static_cast<std::uint8_t>(level);
+    record.argumentCount = static_cast<std::uint16_t>(argumentCount);
+    record.contextId = intern(context);
+    record.formatId = formatted ? internFormat(format) : 0;
+    record.timestamp = timestamp();
+
+    auto payload = arguments.data();
+    auto payloadSize = arguments.size();
+
+    // with a full string table, the message is formatted now instead
+    Arguments text;
+    if (formatted && record.formatId == 0 && *format)
+    {
+        const auto message = formatArguments(format, payload, payloadSize, argumentCount);
+        encodeString(text, message.data(), message.size());
+
+        record.kind = Text;
+        record.argumentCount = 1;
+        payload = text.data();
+        payloadSize = text.size();
+    }
+
+    auto & header = fileHeader(m_memory);
+    const auto capacity = header.ringCapacity;
+    const auto size = aligned(sizeof(RecordHeader) + payloadSize);
+
+    if (size > capacity / 4)
+    {
+        ++m_dropped;
+        return;
+    }
+
+    record.size = static_cast<std::uint32_t>(size);
+
+    const auto ring = m_memory + header.headerSize + header.tableCapacity;
+    const auto offset = header.head % capacity;
+    const auto skip = offset + size > capacity ? capacity - offset : 0;
+
+    // overwrite the oldest records
+    while (header.head + skip + size - header.tail > capacity)
+    {
+        std::uint32_t oldSize;
+        std::memcpy(&oldSize, ring + header.tail % capacity, sizeof(oldSize));
+        header.tail += oldSize;
+    }
+
+    if (skip > 0)
+    {
+        // only size and kind are read from skip records, which may be shorter than a header
+        const auto skipSize = static_cast<std::uint32_t>(skip);
+        const auto skipKind = Skip;
+        std::memcpy(ring + offset, &skipSize, sizeof(skipSize));
+        std::memcpy(ring + offset + sizeof(skipSize), &skipKind, sizeof(skipKind));
+
+        header.head += skip;
+    }
+
+    const auto position = ring + header.head % capacity;
+    std::memcpy(position, &record, sizeof(record));
+    std::memcpy(position + sizeof(record), payload, payloadSize);
+
+    header.head += size;
+}
+
+std::uint32_t BinaryLogHandler::intern(const std::string & text)
+{
+    if (text.empty())
+        return 0;
+
+    const auto found = m_ids.find(text);
+    if (found != m_ids.end())
+        return found->second;
+
+    auto & header = fileHeader(m_memory);
+    const auto entrySize = aligned(sizeof(std::uint32_t) + text.size(), sizeof(std::uint32_t));
+
+    if (header.tableSize + entrySize > header.tableCapacity)
+        return 0;
+
+    const auto entry = m_memory + header.headerSize + header.tableSize;
+    const auto length = static_cast<std::uint32_t>(text.size());
+    std::memcpy(entry, &length, sizeof(length));
+    std::memcpy(entry + sizeof(length), text.data(), length);
+
+    header.tableSize += entrySize;
+    const auto id = ++header.stringCount;
+
+    m_ids.emplace(text, id);
+    return id;
+}
+
+std::uint32_t BinaryLogHandler::internFormat(const char * format)
+{
+    // formats are mostly literals, so their addresses rarely change
+    const auto cached = m_formatIds.find(format);
+    if (cached != m_formatIds.end() && *cached->second.second == format)
+        return cached->second.first;
+
+    const auto id = intern(format);
+    if (id == 0)
+        return 0;
+
+    const auto & interned = m_ids.find(format)->first;
+    m_formatIds[format] = std::make_pair(id, &interned);
+
+    return id;
+}
+
+#ifdef _WIN32
+
+bool BinaryLogHandler::open(std::size_t fileSize)
+{
+    const auto file = CreateFileA(m_logfile.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    const auto size = static_cast<std::uint64_t>(fileSize);
+    const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    const auto memory = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, fileSize);
+    if (!memory)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_memory = static_cast<char *>(memory);
+    m_fileSize = fileSize;
+    m_file = reinterpret_cast<std::intptr_t>(file);
+    m_mapping = reinterpret_cast<std::intptr_t>(mapping);
+
+    return true;
+}
+
+void BinaryLogHandler::close()
+{
+    if (!m_memory)
+        return;
+
+    UnmapViewOfFile(m_memory);
+    CloseHandle(reinterpret_cast<HANDLE>(m_mapping));
+    CloseHandle(reinterpret_cast<HANDLE>(m_file));
+
+    m_memory = nullptr;
+}
+
+#else
+
+bool BinaryLogHandler::open(std::size_t fileSize)
+{
+    const auto file = ::open(m_logfile.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file < 0)
+        return false;
+
+    if (::ftruncate(file, static_cast<off_t>(fileSize)) != 0)
+    {
+        ::close(file);
+        return false;
+    }
+
+    const auto memory = ::mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (memory == MAP_FAILED)
+    {
+        ::close(file);
+        return false;
+    }
+
+    m_memory = static_cast<char *>(memory);
+    m_fileSize = fileSize;
+    m_file = file;
+
+    return true;
+}
+
+void BinaryLogHandler::close()
+{
+    if (!m_memory)
+        return;
+
+    ::munmap(m_memory, m_fileSize);
+    ::close(static_cast<int>(m_file));
+
+    m_memory = nullptr;
+}
+
+#endif
+
+} // namespace loggingzeug
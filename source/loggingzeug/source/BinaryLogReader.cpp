@@ -0,0 +1,122 @@
+#include <loggingzeug/BinaryLogReader.h>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "BinaryLogFormat.h"
+
+namespace loggingzeug
+{
+
+using namespace binarylog;
+
+BinaryLogReader::BinaryLogReader(const std::string & logfile)
+: m_valid(false)
+{
+    m_valid = read(logfile);
+}
+
+bool BinaryLogReader::isValid() const
+{
+    return m_valid;
+}
+
+const std::vector<BinaryLogReader::Record> & BinaryLogReader::records() const
+{
+    return m_records;
+}
+
+bool BinaryLogReader::read(const std::string & logfile)
+{
+    std::ifstream stream(logfile, std::ios_base::in | std::ios_base::binary);
+    if (!stream)
+        return false;
+
+    const std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    FileHeader header;
+    if (file.size() < sizeof(header))
+        return false;
+
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version)
+        return false;
+
+    if (header.ringCapacity == 0 || header.tableSize > header.tableCapacity
+        || file.size() < header.headerSize + header.tableCapacity + header.ringCapacity)
+        return false;
+
+    // id 0 is the empty string
+    std::vector<std::string> strings(1);
+    strings.reserve(header.stringCount + 1);
+
+    const auto table = file.data() + header.headerSize;
+    auto entry = std::uint64_t(0);
+
+    while (strings.size() <= header.stringCount)
+    {
+        std::uint32_t length;
+        if (entry + sizeof(length) > header.tableSize)
+            return false;
+
+        std::memcpy(&length, table + entry, sizeof(length));
+        if (entry + sizeof(length) + length > header.tableSize)
+            return false;
+
+        strings.emplace_back(table + entry + sizeof(length), length);
+        entry += aligned(sizeof(length) + length, sizeof(length));
+    }
+
+    const auto ring = table + header.tableCapacity;
+    const auto capacity = header.ringCapacity;
+
+    if (header.head - header.tail > capacity)
+        return false;
+
+    for (auto position = header.tail; position != header.head; )
+    {
+        const auto offset = position % capacity;
+
+        std::uint32_t size;
+        std::memcpy(&size, ring + offset, sizeof(size));
+
+        if (size == 0 || size % alignment != 0 || offset + size > capacity || position + size > header.head)
+            return false;
+
+        position += size;
+
+        RecordKind kind;
+        std::memcpy(&kind, ring + offset + sizeof(size), sizeof(kind));
+
+        if (kind == Skip)
+            continue;
+
+        RecordHeader record;
+        if (size < sizeof(record))
+            return false;
+
+        std::memcpy(&record, ring + offset, sizeof(record));
+
+        if (record.contextId >= strings.size() || record.formatId >= strings.size() || record.level > LogMessage::Info)
+            return false;
+
+        const auto arguments = ring + offset + sizeof(record);
+        const auto argumentsSize = size - sizeof(record);
+
+        // a text record is formatted as a single string argument to an empty format
+        const auto message = kind == Text
+            ? formatArguments("%;", arguments, argumentsSize, 1)
+            : formatArguments(strings[record.formatId], arguments, argumentsSize, record.argumentCount);
+
+        const auto time = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(record.timestamp)));
+
+        m_records.push_back({ time, LogMessage(static_cast<LogMessage::Level>(record.level), message, strings[record.contextId]) });
+    }
+
+    return true;
+}
+
+} // namespace loggingzeug
@@ -15,21 +15,26 @@ void ConsoleLogHandler::handle(const LogMessage & message)
 
 std::string ConsoleLogHandler::messagePrefix(const LogMessage & message)
 {
-	std::string prefix = levelString(message.level());
+	const auto level = levelString(message.level());
+	const auto & context = message.context();
 
+	if (context.empty())
+		return level.empty() ? level : level + ": ";
 
-	if (!message.context().empty())
-	{
-		if (!prefix.empty())
-			prefix = prefix + " ";
+	// built in place, as this runs for every message
+	std::string prefix;
+	prefix.reserve(level.size() + context.size() + 5);
 
-		prefix = prefix + "[" + message.context() + "]";
-	}
+	prefix += level;
+
+	if (!level.empty())
+		prefix += ' ';
 
-	if (prefix.empty())
-		return prefix;
+	prefix += '[';
+	prefix += context;
+	prefix += "]: ";
 
-	return prefix + ": ";
+	return prefix;
 }
 
 std::string ConsoleLogHandler::levelString(LogMessage::Level level)
@@ -19,21 +19,38 @@ void FileLogHandler::handle(const LogMessage & message)
 
 std::string FileLogHandler::messagePrefix(const LogMessage & message)
 {
-	std::string prefix = levelString(message.level());
+	std::string prefix;
+	appendMessagePrefix(prefix, message);
 
+	return prefix;
+}
+
+void FileLogHandler::appendMessagePrefix(std::string & text, const LogMessage & message)
+{
+	const auto level = levelString(message.level());
+	const auto & context = message.context();
+
+	if (level.empty() && context.empty())
+		return;
 
-	if (!message.context().empty())
+	// level, space, brackets, colon and space
+	const auto size = text.size() + level.size() + context.size() + 5;
+	if (text.capacity() < size)
+		text.reserve(size);
+
+	text += level;
+
+	if (!context.empty())
 	{
-		if (!prefix.empty())
-			prefix = prefix + " ";
+		if (!level.empty())
+			text += ' ';
 
-		prefix = prefix + "[" + message.context() + "]";
+		text += '[';
+		text += context;
+		text += ']';
 	}
 
-	if (prefix.empty())
-		return prefix;
-
-	return prefix + ": ";
+	text += ": ";
 }
 
 std::string FileLogHandler::levelString(LogMessage::Level level)
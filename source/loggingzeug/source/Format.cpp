@@ -0,0 +1,393 @@
+#include <loggingzeug/Format.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#include <loggingzeug/formatString.h>
+
+namespace
+{
+
+template <typename Float>
+void appendPrintf(std::string & output, const char * format, int precision, Float value)
+{
+    char characters[64];
+    const auto count = std::snprintf(characters, sizeof(characters), format, precision, value);
+
+    if (count < 0)
+        return;
+
+    if (static_cast<std::size_t>(count) < sizeof(characters))
+    {
+        output.append(characters, count);
+        return;
+    }
+
+    // only with a huge precision
+    std::unique_ptr<char[]> large(new char[count + 1]);
+    std::snprintf(large.get(), count + 1, format, precision, value);
+    output.append(large.get(), count);
+}
+
+// the printf conversion streams use for floating point values
+std::string printfFormat(const loggingzeug::Format::Specifier & specifier, bool isLong)
+{
+    std::string format = "%";
+
+    if (specifier.showPos)
+        format += '+';
+    if (specifier.showPoint)
+        format += '#';
+
+    format += ".*";
+
+    if (isLong)
+        format += 'L';
+
+    switch (specifier.floatField)
+    {
+    case loggingzeug::Format::Specifier::Fixed:
+        format += specifier.upperCase ? 'F' : 'f';
+        break;
+    case loggingzeug::Format::Specifier::Scientific:
+        format += specifier.upperCase ? 'E' : 'e';
+        break;
+    default:
+        format += specifier.upperCase ? 'G' : 'g';
+        break;
+    }
+
+    return format;
+}
+
+} // namespace
+
+namespace loggingzeug
+{
+
+Format::Specifier::Specifier()
+: alignment(DefaultAlignment)
+, floatField(General)
+, base(DefaultBase)
+, boolAlpha(false)
+, showPos(false)
+, showBase(false)
+, upperCase(false)
+, showPoint(false)
+, hasFill(false)
+, fill(' ')
+, width(0)
+, precision(-1)
+{
+}
+
+Format::Specifier Format::Specifier::parse(const char *& format)
+{
+    Specifier specifier;
+
+    while (*format == 'l' || *format == 'r' || *format == 'i')
+    {
+        switch (*format++)
+        {
+        case 'l':
+            specifier.alignment = Left;
+            break;
+        case 'r':
+            specifier.alignment = Right;
+            break;
+        case 'i':
+            specifier.alignment = Internal;
+            break;
+        }
+    }
+
+    // flags are recognized case-insensitively, but only take effect in lower case
+    while (*format && std::strchr("a+ #up0", std::tolower(static_cast<unsigned char>(*format))))
+    {
+        switch (*format++)
+        {
+        case 'a':
+            specifier.boolAlpha = true;
+            break;
+        case '+':
+            specifier.showPos = true;
+            break;
+        case '#':
+            specifier.showBase = true;
+            break;
+        case 'u':
+            specifier.upperCase = true;
+            break;
+        case 'p':
+            specifier.showPoint = true;
+            break;
+        case '0':
+            specifier.hasFill = true;
+            specifier.fill = '0';
+            break;
+        }
+    }
+
+    const auto floatField = std::tolower(static_cast<unsigned char>(*format));
+
+    if (floatField == 'f' || floatField == 'e')
+    {
+        if (std::isupper(static_cast<unsigned char>(*format)))
+            specifier.upperCase = true;
+
+        specifier.floatField = floatField == 'f' ? Fixed : Scientific;
+        ++format;
+    }
+
+    if (*format == '?' && format[1])
+    {
+        specifier.hasFill = true;
+        specifier.fill = format[1];
+        format += 2;
+    }
+
+    int width;
+    format += readInt(format, width);
+    if (width > 0)
+        specifier.width = width;
+
+    if (*format == '.')
+    {
+        int precision;
+        ++format;
+        format += readInt(format, precision);
+        if (precision > 0)
+            specifier.precision = precision;
+    }
+
+    switch (*format)
+    {
+    case 'd':
+        specifier.base = Decimal;
+        ++format;
+        break;
+    case 'o':
+        specifier.base = Octal;
+        ++format;
+        break;
+    case 'x':
+        specifier.base = Hexadecimal;
+        ++format;
+        break;
+    }
+
+    while (*format && *format++ != ';');
+
+    return specifier;
+}
+
+void Format::Specifier::apply(std::ostream & stream) const
+{
+    switch (alignment)
+    {
+    case Left:
+        stream.setf(std::ios_base::left, std::ios_base::adjustfield);
+        break;
+    case Right:
+        stream.setf(std::ios_base::right, std::ios_base::adjustfield);
+        break;
+    case Internal:
+        stream.setf(std::ios_base::internal, std::ios_base::adjustfield);
+        break;
+    default:
+        break;
+    }
+
+    if (boolAlpha)
+        stream.setf(std::ios_base::boolalpha);
+    if (showPos)
+        stream.setf(std::ios_base::showpos);
+    if (showBase)
+        stream.setf(std::ios_base::showbase);
+    if (upperCase)
+        stream.setf(std::ios_base::uppercase);
+    if (showPoint)
+        stream.setf(std::ios_base::showpoint);
+
+    switch (floatField)
+    {
+    case Fixed:
+        stream.setf(std::ios_base::fixed, std::ios_base::floatfield);
+        break;
+    case Scientific:
+        stream.setf(std::ios_base::scientific, std::ios_base::floatfield);
+        break;
+    default:
+        break;
+    }
+
+    if (hasFill)
+        stream.fill(fill);
+    if (width > 0)
+        stream.width(width);
+    if (precision >= 0)
+        stream.precision(precision);
+
+    switch (base)
+    {
+    case Decimal:
+        stream.setf(std::ios_base::dec, std::ios_base::basefield);
+        break;
+    case Octal:
+        stream.setf(std::ios_base::oct, std::ios_base::basefield);
+        break;
+    case Hexadecimal:
+        stream.setf(std::ios_base::hex, std::ios_base::basefield);
+        break;
+    default:
+        break;
+    }
+}
+
+Format::Format(const char * format)
+: m_format(format)
+, m_trailingBegin(0)
+{
+    // formatString streams all arguments into one stream, thus fill and precision carry over to later arguments
+    auto fill = ' ';
+    auto precision = 6;
+
+    const auto begin = m_format.c_str();
+    auto current = begin;
+    auto textBegin = std::size_t(0);
+
+    while (*current)
+    {
+        if (*current == '%' && *++current != '%')
+        {
+            Segment segment;
+            segment.textBegin = textBegin;
+            segment.textLength = m_text.size() - textBegin;
+            segment.specifier = Specifier::parse(current);
+            segment.formatEnd = static_cast<std::size_t>(current - begin);
+
+            auto & specifier = segment.specifier;
+
+            if (specifier.hasFill)
+                fill = specifier.fill;
+            if (specifier.precision >= 0)
+                precision = specifier.precision;
+
+            specifier.hasFill = true;
+            specifier.fill = fill;
+            specifier.precision = precision;
+
+            m_segments.push_back(segment);
+            textBegin = m_text.size();
+        }
+        else
+        {
+            m_text += *current++;
+        }
+    }
+
+    m_trailingBegin = textBegin;
+}
+
+std::size_t Format::specifierCount() const
+{
+    return m_segments.size();
+}
+
+void Format::appendValues(std::string & output, std::size_t index) const
+{
+    // like formatString, the format behind the last argument is written as is
+    output.append(m_format, index > 0 ? m_segments[index - 1].formatEnd : 0, std::string::npos);
+}
+
+void Format::appendInteger(std::string & output, const Specifier & specifier, unsigned long long magnitude, bool negative, bool isSigned)
+{
+    const auto radix = specifier.base == Specifier::Hexadecimal ? 16u : specifier.base == Specifier::Octal ? 8u : 10u;
+    const auto digitCharacters = specifier.upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    // enough for the octal digits of 64 bit values
+    char digits[24];
+    auto end = digits + sizeof(digits);
+    auto begin = end;
+
+    auto value = magnitude;
+    do
+    {
+        *--begin = digitCharacters[value % radix];
+        value /= radix;
+    }
+    while (value);
+
+    char prefix[2];
+    auto prefixLength = std::size_t(0);
+
+    if (radix == 10)
+    {
+        if (negative)
+            prefix[prefixLength++] = '-';
+        else if (specifier.showPos && isSigned)
+            prefix[prefixLength++] = '+';
+    }
+    else if (specifier.showBase && magnitude != 0)
+    {
+        prefix[prefixLength++] = '0';
+
+        if (radix == 16)
+            prefix[prefixLength++] = specifier.upperCase ? 'X' : 'x';
+    }
+
+    appendPadded(output, specifier, prefix, prefixLength, begin, static_cast<std::size_t>(end - begin));
+}
+
+void Format::appendFloat(std::string & output, const Specifier & specifier, double value)
+{
+    std::string body;
+    appendPrintf(body, printfFormat(specifier, false).c_str(), specifier.precision, value);
+
+    const auto prefixLength = std::size_t(!body.empty() && (body[0] == '+' || body[0] == '-') ? 1 : 0);
+    appendPadded(output, specifier, body.data(), prefixLength, body.data() + prefixLength, body.size() - prefixLength);
+}
+
+void Format::appendFloat(std::string & output, const Specifier & specifier, long double value)
+{
+    std::string body;
+    appendPrintf(body, printfFormat(specifier, true).c_str(), specifier.precision, value);
+
+    const auto prefixLength = std::size_t(!body.empty() && (body[0] == '+' || body[0] == '-') ? 1 : 0);
+    appendPadded(output, specifier, body.data(), prefixLength, body.data() + prefixLength, body.size() - prefixLength);
+}
+
+void Format::appendText(std::string & output, const Specifier & specifier, const char * text, std::size_t length)
+{
+    appendPadded(output, specifier, "", 0, text, length);
+}
+
+void Format::appendPadded(std::string & output, const Specifier & specifier, const char * prefix, std::size_t prefixLength, const char * body, std::size_t bodyLength)
+{
+    const auto length = prefixLength + bodyLength;
+    const auto padding = specifier.width > 0 && static_cast<std::size_t>(specifier.width) > length
+        ? static_cast<std::size_t>(specifier.width) - length : 0;
+
+    switch (specifier.alignment)
+    {
+    case Specifier::Left:
+        output.append(prefix, prefixLength);
+        output.append(body, bodyLength);
+        output.append(padding, specifier.fill);
+        break;
+    case Specifier::Internal:
+        output.append(prefix, prefixLength);
+        output.append(padding, specifier.fill);
+        output.append(body, bodyLength);
+        break;
+    default:
+        output.append(padding, specifier.fill);
+        output.append(prefix, prefixLength);
+        output.append(body, bodyLength);
+        break;
+    }
+}
+
+} // namespace loggingzeug
@@ -1,5 +1,7 @@
 #include <loggingzeug/LogMessage.h>
 
+#include <utility>
+
 namespace loggingzeug
 {
 
@@ -10,6 +12,13 @@ LogMessage::LogMessage(Level level, const std::string& message, const std::strin
 {
 }
 
+LogMessage::LogMessage(Level level, std::string&& message, std::string&& context)
+: m_level(level)
+, m_message(std::move(message))
+, m_context(std::move(context))
+{
+}
+
 LogMessage::Level LogMessage::level() const
 {
 	return m_level;
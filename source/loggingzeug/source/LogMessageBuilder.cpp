@@ -1,157 +1,330 @@
 
 #include <loggingzeug/LogMessageBuilder.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <cassert>
+#include <utility>
 
 #include <loggingzeug/AbstractLogHandler.h>
 
 
+namespace
+{
+
+/*  The manipulator types are unspecified, so they are applied to a stream without
+    buffer to read back which formatting state they change.
+*/
+template <typename Manipulator>
+void applyManipulator(const Manipulator & manipulator, int & precision, int & width, char & fill)
+{
+    std::ostream probe(nullptr);
+    probe.precision(precision);
+    probe.width(width);
+    probe.fill(fill);
+
+    probe << manipulator;
+
+    precision = static_cast<int>(probe.precision());
+    width = static_cast<int>(probe.width());
+    fill = probe.fill();
+}
+
+} // namespace
+
+
 namespace loggingzeug
 {
 
 LogMessageBuilder::LogMessageBuilder(LogMessage::Level level, AbstractLogHandler * handler, const std::string & context)
 : m_level(level)
 , m_handler(handler)
-, m_context(context)
-, m_stream(new std::stringstream)
+, m_precision(6)
+, m_width(0)
+, m_fill(' ')
+, m_data(m_inline)
+, m_size(0)
+, m_capacity(s_inlineSize)
 {
-    assert(handler != nullptr);
+    // without handler, the message is discarded anyway
+    if (!handler)
+        return;
+
+    m_context = context;
 }
 
-LogMessageBuilder::LogMessageBuilder(const LogMessageBuilder & builder)
+LogMessageBuilder::LogMessageBuilder(LogMessageBuilder && builder)
 : m_level(builder.m_level)
 , m_handler(builder.m_handler)
-, m_context(builder.m_context)
-, m_stream(builder.m_stream)
+, m_context(std::move(builder.m_context))
+, m_precision(builder.m_precision)
+, m_width(builder.m_width)
+, m_fill(builder.m_fill)
+, m_data(m_inline)
+, m_size(builder.m_size)
+, m_capacity(s_inlineSize)
 {
+    if (builder.m_heap)
+    {
+        m_heap = std::move(builder.m_heap);
+        m_data = m_heap.get();
+        m_capacity = builder.m_capacity;
+    }
+    else
+    {
+        std::memcpy(m_inline, builder.m_inline, m_size);
+    }
+
+    builder.m_handler = nullptr;
 }
 
 LogMessageBuilder::~LogMessageBuilder()
 {
-    if (m_stream.use_count() > 1)
+    if (!m_handler)
         return;
 
-	if (m_handler)
-        m_handler->handle(LogMessage(m_level, m_stream->str(), m_context));
+    m_handler->handle(LogMessage(m_level, std::string(m_data, m_size), std::move(m_context)));
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(const char * c)
 {
     assert(c != nullptr);
 
-    m_stream->write(c, std::strlen(c));
-	return *this;
+    if (m_handler)
+        append(c, std::strlen(c));
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(const std::string & str)
 {
-    m_stream->write(str.c_str(), str.length());
-	return *this;
+    if (m_handler)
+        append(str.data(), str.length());
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(bool b)
 {
-	*this << (b ? "true" : "false");
-	return *this;
+    *this << (b ? "true" : "false");
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(char c)
 {
-    *m_stream << c;
-	return *this;
+    if (m_handler)
+        appendField(&c, 1);
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(int i)
 {
-    *m_stream << i;
-	return *this;
+    if (m_handler)
+        appendInteger(i < 0 ? 0u - static_cast<unsigned>(i) : static_cast<unsigned>(i), i < 0);
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(float f)
 {
-    *m_stream << f;
-	return *this;
+    return *this << static_cast<double>(f);
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(double d)
 {
-    *m_stream << d;
-	return *this;
+    if (m_handler)
+        appendFloat(d, "%.*g");
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(long double d)
 {
-    *m_stream << d;
-	return *this;
+    if (m_handler)
+        appendFloat(d, "%.*Lg");
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(unsigned u)
 {
-    *m_stream << u;
-	return *this;
+    if (m_handler)
+        appendInteger(u, false);
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(long l)
 {
-    *m_stream << l;
-	return *this;
+    if (m_handler)
+        appendInteger(l < 0 ? 0ul - static_cast<unsigned long>(l) : static_cast<unsigned long>(l), l < 0);
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(long long l)
 {
-    *m_stream << l;
+    if (m_handler)
+        appendInteger(l < 0 ? 0ull - static_cast<unsigned long long>(l) : static_cast<unsigned long long>(l), l < 0);
     return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(unsigned long ul)
 {
-    *m_stream << ul;
-	return *this;
+    if (m_handler)
+        appendInteger(ul, false);
+    return *this;
 }
 
-LogMessageBuilder & LogMessageBuilder::operator<<(unsigned long long ul)
+LogMessageBuilder & LogMessageBuilder::operator<<(unsigned long long ull)
 {
-    *m_stream << ul;
+    if (m_handler)
+        appendInteger(ull, false);
     return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(unsigned char uc)
 {
-    *m_stream << uc;
-	return *this;
+    if (m_handler)
+        appendField(reinterpret_cast<const char *>(&uc), 1);
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(const void * pointer)
 {
-    *m_stream << pointer;
-	return *this;
+    if (!m_handler)
+        return *this;
+
+    auto value = reinterpret_cast<std::uintptr_t>(pointer);
+
+    if (!value)
+    {
+        appendField("0", 1);
+        return *this;
+    }
+
+    char digits[2 + 2 * sizeof(value)];
+    auto end = digits + sizeof(digits);
+    auto begin = end;
+
+    for (; value; value /= 16)
+        *--begin = "0123456789abcdef"[value % 16];
+
+    *--begin = 'x';
+    *--begin = '0';
+
+    appendField(begin, static_cast<std::size_t>(end - begin));
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(std::ostream & (*manipulator)(std::ostream &))
 {
-    *m_stream << manipulator;
-	return *this;
+    if (!m_handler)
+        return *this;
+
+    if (manipulator == static_cast<std::ostream & (*)(std::ostream &)>(std::endl))
+        append("\n", 1);
+    else if (manipulator == static_cast<std::ostream & (*)(std::ostream &)>(std::ends))
+        append("", 1);
+
+    return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(LogMessageBuilder::PrecisionManipulator manipulator)
 {
-    *m_stream << manipulator;
+    applyManipulator(manipulator, m_precision, m_width, m_fill);
     return *this;
 }
 
 LogMessageBuilder & LogMessageBuilder::operator<<(LogMessageBuilder::FillManipulator manipulator)
 {
-    *m_stream << manipulator;
+    applyManipulator(manipulator, m_precision, m_width, m_fill);
     return *this;
 }
 
 #ifndef _MSC_VER
 LogMessageBuilder & LogMessageBuilder::operator<<(LogMessageBuilder::WidthManipulator manipulator)
 {
-    *m_stream << manipulator;
+    applyManipulator(manipulator, m_precision, m_width, m_fill);
     return *this;
 }
 #endif
 
+void LogMessageBuilder::append(const char * characters, std::size_t count)
+{
+    reserve(count);
+
+    std::memcpy(m_data + m_size, characters, count);
+    m_size += count;
+}
+
+void LogMessageBuilder::appendField(const char * characters, std::size_t count)
+{
+    const auto width = static_cast<std::size_t>(std::max(m_width, 0));
+    m_width = 0;
+
+    if (width > count)
+    {
+        reserve(width);
+
+        std::memset(m_data + m_size, m_fill, width - count);
+        m_size += width - count;
+    }
+
+    append(characters, count);
+}
+
+void LogMessageBuilder::reserve(std::size_t count)
+{
+    if (m_size + count <= m_capacity)
+        return;
+
+    const auto capacity = std::max(2 * m_capacity, m_size + count);
+
+    std::unique_ptr<char[]> heap(new char[capacity]);
+    std::memcpy(heap.get(), m_data, m_size);
+
+    m_heap = std::move(heap);
+    m_data = m_heap.get();
+    m_capacity = capacity;
+}
+
+template <typename Unsigned>
+void LogMessageBuilder::appendInteger(Unsigned value, bool negative)
+{
+    // enough for the decimal digits of 64 bit values and the sign
+    char digits[24];
+    auto end = digits + sizeof(digits);
+    auto begin = end;
+
+    do
+    {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while (value);
+
+    if (negative)
+        *--begin = '-';
+
+    appendField(begin, static_cast<std::size_t>(end - begin));
+}
+
+template <typename Float>
+void LogMessageBuilder::appendFloat(Float value, const char * format)
+{
+    // the default floatfield of streams, formatted without their locale machinery
+    char characters[64];
+    const auto count = std::snprintf(characters, sizeof(characters), format, m_precision, value);
+
+    if (count < 0)
+        return;
+
+    if (static_cast<std::size_t>(count) < sizeof(characters))
+    {
+        appendField(characters, static_cast<std::size_t>(count));
+        return;
+    }
+
+    // only with a huge precision
+    std::unique_ptr<char[]> large(new char[count + 1]);
+    std::snprintf(large.get(), count + 1, format, m_precision, value);
+    appendField(large.get(), static_cast<std::size_t>(count));
+}
+
 } // namespace loggingzeug
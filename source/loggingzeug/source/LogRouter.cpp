@@ -0,0 +1,155 @@
+#include <loggingzeug/LogRouter.h>
+
+#include <cassert>
+#include <unordered_map>
+
+namespace
+{
+
+std::atomic<std::uint64_t> s_routers(0);
+
+struct DecisionCache
+{
+    DecisionCache()
+    : generation(0)
+    {
+    }
+
+    std::uint64_t generation;
+    std::unordered_map<std::string, std::vector<int>> decisions;
+};
+
+// per router id; references to the entries stay valid when routers that are sinks of another add theirs
+thread_local std::unordered_map<std::uint64_t, DecisionCache> t_caches;
+
+} // namespace
+
+namespace loggingzeug
+{
+
+LogRouter::LogRouter()
+: m_id(++s_routers)
+, m_generation(1)
+{
+}
+
+LogRouter::~LogRouter()
+{
+    // caches of other threads are released when these exit
+    t_caches.erase(m_id);
+}
+
+std::size_t LogRouter::addSink(AbstractLogHandler * handler, LogMessage::Level maxLevel)
+{
+    assert(handler != nullptr);
+
+    Sink sink;
+    sink.handler.reset(handler);
+    sink.maxLevel = maxLevel;
+
+    m_sinks.push_back(std::move(sink));
+    clearDecisions();
+
+    return m_sinks.size() - 1;
+}
+
+std::size_t LogRouter::sinkCount() const
+{
+    return m_sinks.size();
+}
+
+AbstractLogHandler * LogRouter::sink(std::size_t index) const
+{
+    assert(index < m_sinks.size());
+
+    return m_sinks[index].handler.get();
+}
+
+void LogRouter::setMaxLevel(std::size_t sink, LogMessage::Level maxLevel)
+{
+    assert(sink < m_sinks.size());
+
+    m_sinks[sink].maxLevel = maxLevel;
+    clearDecisions();
+}
+
+void LogRouter::includeContext(std::size_t sink, const std::string & context)
+{
+    assert(sink < m_sinks.size());
+
+    m_sinks[sink].included.insert(context);
+    clearDecisions();
+}
+
+void LogRouter::excludeContext(std::size_t sink, const std::string & context)
+{
+    assert(sink < m_sinks.size());
+
+    m_sinks[sink].excluded.insert(context);
+    clearDecisions();
+}
+
+LogMessage::Level LogRouter::maxLevel() const
+{
+    auto level = LogMessage::Fatal;
+
+    for (const auto & sink : m_sinks)
+    {
+        if (sink.maxLevel > level)
+            level = sink.maxLevel;
+    }
+
+    return level;
+}
+
+void LogRouter::handle(const LogMessage & message)
+{
+    const auto & levels = decision(message.context());
+
+    for (std::size_t i = 0; i < m_sinks.size(); ++i)
+    {
+        if (message.level() <= levels[i])
+            m_sinks[i].handler->handle(message);
+    }
+}
+
+const LogRouter::Decision & LogRouter::decision(const std::string & context)
+{
+    auto & cache = t_caches[m_id];
+
+    // entries stay in place until the sinks are reconfigured
+    const auto generation = m_generation.load(std::memory_order_acquire);
+    if (cache.generation != generation)
+    {
+        cache.decisions.clear();
+        cache.generation = generation;
+    }
+
+    const auto found = cache.decisions.find(context);
+    if (found != cache.decisions.end())
+        return found->second;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Decision levels;
+    levels.reserve(m_sinks.size());
+
+    for (const auto & sink : m_sinks)
+    {
+        const auto accepted = (sink.included.empty() || sink.included.count(context) > 0)
+            && sink.excluded.count(context) == 0;
+
+        levels.push_back(accepted ? static_cast<int>(sink.maxLevel) : -1);
+    }
+
+    return cache.decisions.emplace(context, std::move(levels)).first->second;
+}
+
+void LogRouter::clearDecisions()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_generation.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace loggingzeug
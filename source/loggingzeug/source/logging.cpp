@@ -17,7 +17,7 @@ namespace loggingzeug
 
 LogMessageBuilder info(const std::string & context, LogMessage::Level level)
 {
-    return LogMessageBuilder(level, level <= l_verbosityLevel ? l_logHandler : nullptr, context);
+    return LogMessageBuilder(level, isEnabled(level) ? l_logHandler : nullptr, context);
 }
 
 LogMessageBuilder debug(const std::string & context)
@@ -61,4 +61,9 @@ LogMessage::Level verbosityLevel()
     return l_verbosityLevel;
 }
 
+bool isEnabled(LogMessage::Level level)
+{
+    return level <= l_verbosityLevel && l_logHandler != nullptr;
+}
+
 } // namespace loggingzeug
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
 
 #include <signalzeug/signalzeug_api.h>
 #include <signalzeug/Connection.h>
@@ -15,8 +16,12 @@ class SIGNALZEUG_API AbstractSignal
 
 public:
 	AbstractSignal();
+	/** A copy starts without connections, since connections refer to the signal they were made with. */
+	AbstractSignal(const AbstractSignal & signal);
 	virtual ~AbstractSignal();
 
+	AbstractSignal & operator=(const AbstractSignal & signal);
+
 protected:
 	Connection createConnection() const;
 	void disconnect(Connection & connection) const;
@@ -25,8 +30,11 @@ protected:
 	virtual void disconnectId(Connection::Id id) const = 0;
 
 protected:
-	mutable Connection::Id m_nextId;
-	mutable std::unordered_map<Connection::Id, Connection> m_connections;
+	// entry in the SignalRegistry, through which connections refer to this signal
+	std::uint32_t m_index;
+	std::uint32_t m_generation;
+	// connections may be made from any thread
+	mutable std::atomic<Connection::Id> m_nextId;
 };
 
 } // namespace signalzeug
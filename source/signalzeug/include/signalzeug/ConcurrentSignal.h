@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <signalzeug/signalzeug_api.h>
+#include <signalzeug/AbstractSignal.h>
+#include <signalzeug/Dispatcher.h>
+#include <signalzeug/EpochReclaimer.h>
+#include <signalzeug/Trackable.h>
+
+
+namespace signalzeug
+{
+
+/** \brief Signal that may be fired, connected and disconnected from any thread concurrently.
+
+	The connected slots form an immutable list. connect() and disconnect() publish a
+	modified copy of it (copy-on-write), while fire() calls the slots of the list
+	current at its start without taking a lock. Replaced lists are destroyed once no
+	fire() can still be using them (see EpochReclaimer).
+
+	Slots may connect and disconnect, including themselves, while being called.
+	A slot disconnected while the signal is being fired on another thread may still
+	be called by that fire(). Slots run in connection order. Slots of destroyed Trackable
+	receivers are skipped and disconnected.
+
+	\code{.cpp}
+
+		ConcurrentSignal<float> progress;
+
+		auto connection = progress.connect([&] (float value) { bar.setValue(value); });
+
+		parallel_for(0, count, [&] (int i)
+		{
+			process(i);
+			progress.fire(float(i) / count);
+		});
+
+	\endcode
+
+	\see Signal
+*/
+template <typename... Arguments>
+class ConcurrentSignal : public AbstractSignal
+{
+public:
+	typedef std::function<void(Arguments...)> Callback;
+
+	ConcurrentSignal();
+	virtual ~ConcurrentSignal();
+
+	ConcurrentSignal(const ConcurrentSignal &) = delete;
+	ConcurrentSignal & operator=(const ConcurrentSignal &) = delete;
+
+	void fire(Arguments... arguments) const;
+	void operator()(Arguments... arguments) const;
+
+	Connection connect(Callback callback) const;
+	/** Queued connection: the callback is called from dispatcher.processEvents(), which has to outlive the connection. */
+	Connection connect(Callback callback, Dispatcher & dispatcher, Delivery delivery = Delivery::Queued) const;
+	/** The callback is disconnected once receiver is destroyed. */
+	Connection connect(Callback callback, const Trackable & receiver) const;
+	Connection connect(ConcurrentSignal & signal) const;
+
+	/** If T is Trackable, the slot is disconnected once object is destroyed. */
+	template <class T>
+	Connection connect(T * object, void (T::*method)(Arguments...)) const;
+
+	void block();
+	void unblock();
+
+	Connection onFire(std::function<void()> callback) const;
+
+protected:
+	struct Slot
+	{
+		Connection::Id id;
+		Callback callback;
+		// the receiver's tracker, if it is Trackable
+		std::shared_ptr<const Tracker> tracker;
+	};
+
+	typedef std::vector<Slot> Slots;
+
+	Connection connect(Callback callback, std::shared_ptr<const Tracker> tracker) const;
+
+	virtual void disconnectId(Connection::Id id) const override;
+
+	// replaces the published slots; m_writeMutex has to be locked
+	void publish(Slots * slots) const;
+
+protected:
+	mutable std::mutex m_writeMutex;
+	mutable std::atomic<const Slots *> m_slots;
+	mutable EpochReclaimer m_reclaimer;
+	std::atomic<bool> m_blocked;
+};
+
+} // namespace signalzeug
+
+#include <signalzeug/ConcurrentSignal.hpp>
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <signalzeug/ConcurrentSignal.h>
+
+#include <signalzeug/profiling.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace signalzeug
+{
+
+template <typename... Arguments>
+ConcurrentSignal<Arguments...>::ConcurrentSignal()
+: m_slots(new Slots)
+, m_blocked(false)
+{
+}
+
+template <typename... Arguments>
+ConcurrentSignal<Arguments...>::~ConcurrentSignal()
+{
+	delete m_slots.load();
+}
+
+template <typename... Arguments>
+void ConcurrentSignal<Arguments...>::fire(Arguments... arguments) const
+{
+	if (m_blocked)
+		return;
+
+	SIGNALZEUG_PROFILE_FIRE(this);
+
+	EpochReclaimer::ReadGuard guard(m_reclaimer);
+
+	for (auto & slot : *m_slots.load())
+	{
+		if (slot.tracker && !slot.tracker->alive())
+		{
+			disconnectId(slot.id);
+			continue;
+		}
+
+		SIGNALZEUG_PROFILE_SLOT(this, slot.id);
+		slot.callback(arguments...);
+	}
+}
+
+template <typename... Arguments>
+void ConcurrentSignal<Arguments...>::operator()(Arguments... arguments) const
+{
+	fire(arguments...);
+}
+
+template <typename... Arguments>
+Connection ConcurrentSignal<Arguments...>::connect(Callback callback) const
+{
+	return connect(std::move(callback), nullptr);
+}
+
+template <typename... Arguments>
+Connection ConcurrentSignal<Arguments...>::connect(Callback callback, const Trackable & receiver) const
+{
+	return connect(std::move(callback), receiver.tracker());
+}
+
+template <typename... Arguments>
+Connection ConcurrentSignal<Arguments...>::connect(Callback callback, std::shared_ptr<const Tracker> tracker) const
+{
+	Connection connection = createConnection();
+
+	std::lock_guard<std::mutex> lock(m_writeMutex);
+
+	auto slots = new Slots(*m_slots.load());
+	slots->push_back(Slot{ connection.id(), std::move(callback), std::move(tracker) });
+	publish(slots);
+
+	return connection;
+}
+
+template <typename... Arguments>
+Connection ConcurrentSignal<Arguments...>::connect(Callback callback, Dispatcher & dispatcher, Delivery delivery) const
+{
+	return connect(dispatcher.queued(std::move(callback), delivery));
+}
+
+template <typename... Arguments>
+template <class T>
+Connection ConcurrentSignal<Arguments...>::connect(T * object, void (T::*method)(Arguments...)) const
+{
+	return connect([object, method](Arguments... arguments)
+	{
+		(object->*method)(arguments...);
+	}, trackerOf(object));
+}
+
+template <typename... Arguments>
+Connection ConcurrentSignal<Arguments...>::connect(ConcurrentSignal & signal) const
+{
+	return connect([&signal](Arguments... arguments)
+	{
+		signal.fire(arguments...);
+	});
+}
+
+template <typename... Arguments>
+Connection ConcurrentSignal<Arguments...>::onFire(std::function<void()> callback) const
+{
+	return connect([callback](Arguments... /*arguments*/)
+	{
+		callback();
+	});
+}
+
+template <typename... Arguments>
+void ConcurrentSignal<Arguments...>::block()
+{
+	m_blocked = true;
+}
+
+template <typename... Arguments>
+void ConcurrentSignal<Arguments...>::unblock()
+{
+	m_blocked = false;
+}
+
+template <typename... Arguments>
+void ConcurrentSignal<Arguments...>::disconnectId(Connection::Id id) const
+{
+	std::lock_guard<std::mutex> lock(m_writeMutex);
+
+	const auto & current = *m_slots.load();
+
+	const auto matches = [id] (const Slot & slot)
+	{
+		return slot.id == id;
+	};
+
+	// connections may be disconnected more than once, e.g., through copies
+	if (std::none_of(current.begin(), current.end(), matches))
+		return;
+
+	auto slots = new Slots;
+	slots->reserve(current.size());
+
+	std::remove_copy_if(current.begin(), current.end(), std::back_inserter(*slots), matches);
+
+	publish(slots);
+}
+
+template <typename... Arguments>
+void ConcurrentSignal<Arguments...>::publish(Slots * slots) const
+{
+	const auto previous = m_slots.exchange(slots);
+
+	m_reclaimer.retire([previous] ()
+	{
+		delete previous;
+	});
+}
+
+} // namespace signalzeug
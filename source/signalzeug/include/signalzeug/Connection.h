@@ -1,6 +1,6 @@
 #pragma once
 
-#include <memory>
+#include <cstdint>
 
 #include <signalzeug/signalzeug_api.h>
 
@@ -10,6 +10,14 @@ namespace signalzeug
 
 class AbstractSignal;
 
+/** \brief Handle to a connection between a signal and a slot.
+
+	A connection is a plain value of the signal's entry in a process-wide table, the
+	entry's generation and the id of the slot, so making, copying and breaking connections
+	does not allocate. Destroying the signal increments the generation of its entry, which
+	makes disconnect() a no-op for all connections to it. Disconnecting a connection more
+	than once, e.g., through copies, is harmless.
+*/
 class SIGNALZEUG_API Connection
 {
 	friend class AbstractSignal;
@@ -17,14 +25,6 @@ class SIGNALZEUG_API Connection
 public:
     typedef unsigned int Id;
 
-
-protected:
-    struct State
-	{
-		const AbstractSignal * signal;
-		Id id;
-	};
-
 public:
 	Connection();
 
@@ -34,13 +34,14 @@ public:
 
 protected:
     Connection(
-        const AbstractSignal * signal
+        std::uint32_t index
+    ,   std::uint32_t generation
     ,   Id id);
 
-	void detach();
-
 protected:
-	std::shared_ptr<State> m_state;
+	std::uint32_t m_index;
+	std::uint32_t m_generation;
+	Id m_id;
 };
 
 } // namespace signalzeug
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <signalzeug/signalzeug_api.h>
+
+
+namespace signalzeug
+{
+
+/** How a slot connected through a Dispatcher receives the fires of its signal.
+
+	- Queued: every fire is delivered, in order
+	- Coalesced: fires that happen until the slot is called are delivered once, with the latest arguments
+*/
+enum class Delivery : char { Queued, Coalesced };
+
+/** \brief Event queue that delivers signals on the thread processing it (queued connections).
+
+	A slot connected with Signal::connect(callback, dispatcher) does not run when the
+	signal is fired. Instead, the arguments are posted to the dispatcher and the slot is
+	called from processEvents(), on whichever thread calls it, typically the thread owning
+	the receiver. Firing thus never blocks on slow slots, e.g., a worker thread reporting
+	progress to a user interface.
+
+	processEvents() delivers the events posted up to its start as one batch; events posted
+	while processing are left for the next call. Events of a connection that is disconnected
+	before they are delivered are dropped.
+
+	Events can also be posted with a delay, which throttled() and debounced() use to limit
+	the rate at which a slot is called.
+
+	Dispatchers can be integrated into any event loop: setWakeUp() registers a callback
+	that is called whenever events arrive at an empty queue, e.g., to post a single event
+	to the Qt event loop that then calls processEvents(); remainingTime() tells when delayed
+	events become due. Without an event loop, a thread can block in waitForEvents().
+
+	\code{.cpp}
+
+		// user interface thread
+		auto & dispatcher = Dispatcher::current();
+		progress.connect([&] (float value) { bar.setValue(value); }, dispatcher, Delivery::Coalesced);
+
+		// worker threads fire progress, the user interface thread regularly calls
+		dispatcher.processEvents();
+
+	\endcode
+*/
+class SIGNALZEUG_API Dispatcher
+{
+public:
+	typedef std::function<void()> Event;
+	typedef std::chrono::steady_clock Clock;
+
+public:
+	Dispatcher();
+	/** Pending events are dropped. */
+	~Dispatcher();
+
+	Dispatcher(const Dispatcher &) = delete;
+	Dispatcher & operator=(const Dispatcher &) = delete;
+
+	/** The dispatcher of the calling thread, created on first use. */
+	static Dispatcher & current();
+
+	/** Queues an event; may be called from any thread. */
+	void post(Event event);
+	/** Queues an event that is processed once the delay has passed. */
+	void post(Event event, Clock::duration delay);
+
+	/** Calls the events posted so far, and the delayed ones that are due, on the calling thread and returns their number. */
+	std::size_t processEvents();
+
+	bool hasPendingEvents() const;
+
+	/** Time until the next event is due; zero if events are pending, Clock::duration::max() if there are none. */
+	Clock::duration remainingTime() const;
+
+	/** Blocks until events are pending or due or interrupt() is called. */
+	void waitForEvents();
+	void interrupt();
+
+	/** The callback is called on the posting thread whenever events arrive at an empty queue or a delayed event becomes the next one due. */
+	void setWakeUp(std::function<void()> wakeUp);
+
+	/** Wraps callback, so that calling it posts the call to this dispatcher instead. */
+	template <typename... Arguments>
+	std::function<void(Arguments...)> queued(std::function<void(Arguments...)> callback, Delivery delivery = Delivery::Queued);
+
+	/** Like queued() with Delivery::Coalesced, but calls to callback are at least interval apart. */
+	template <typename... Arguments>
+	std::function<void(Arguments...)> throttled(std::function<void(Arguments...)> callback, Clock::duration interval);
+
+	/** Like queued() with Delivery::Coalesced, but callback is only called once no calls happened for interval. */
+	template <typename... Arguments>
+	std::function<void(Arguments...)> debounced(std::function<void(Arguments...)> callback, Clock::duration interval);
+
+protected:
+	struct Timer
+	{
+		Clock::time_point due;
+		std::uint64_t sequence;
+		Event event;
+	};
+
+	// orders the heap of timers by due time, then by posting order
+	static bool later(const Timer & timer, const Timer & other);
+
+	// state of a throttled or debounced callback; events refer to it weakly
+	template <typename... Arguments>
+	struct RateLimited
+	{
+		std::function<void(Arguments...)> callback;
+		std::mutex mutex;
+		Event latest;
+		Clock::time_point time;
+		bool posted;
+	};
+
+	// posts the delivery of a debounced callback, which reposts itself while calls keep coming in
+	template <typename... Arguments>
+	void postDebounced(std::weak_ptr<RateLimited<Arguments...>> receiver, Clock::duration delay);
+
+protected:
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::vector<Event> m_events;
+	std::vector<Timer> m_timers;
+	std::uint64_t m_timerSequence;
+	std::shared_ptr<std::function<void()>> m_wakeUp;
+	bool m_interrupted;
+};
+
+} // namespace signalzeug
+
+#include <signalzeug/Dispatcher.hpp>
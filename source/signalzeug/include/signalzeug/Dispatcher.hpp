@@ -0,0 +1,149 @@
+#pragma once
+
+#include <signalzeug/Dispatcher.h>
+
+namespace signalzeug
+{
+
+template <typename... Arguments>
+std::function<void(Arguments...)> Dispatcher::queued(std::function<void(Arguments...)> callback, Delivery delivery)
+{
+	typedef std::function<void(Arguments...)> Callback;
+
+	if (delivery == Delivery::Coalesced)
+		return throttled(std::move(callback), Clock::duration::zero());
+
+	// posted events only hold weak references, so they are dropped once the slot is released
+	const auto receiver = std::make_shared<Callback>(std::move(callback));
+
+	return [this, receiver](Arguments... arguments)
+	{
+		const std::weak_ptr<Callback> weakReceiver = receiver;
+
+		post([weakReceiver, arguments...]() mutable
+		{
+			if (const auto callback = weakReceiver.lock())
+				(*callback)(arguments...);
+		});
+	};
+}
+
+template <typename... Arguments>
+std::function<void(Arguments...)> Dispatcher::throttled(std::function<void(Arguments...)> callback, Clock::duration interval)
+{
+	typedef RateLimited<Arguments...> State;
+
+	const auto receiver = std::make_shared<State>();
+	receiver->callback = std::move(callback);
+	// time of the last delivery
+	receiver->time = Clock::now() - interval;
+	receiver->posted = false;
+
+	return [this, receiver, interval](Arguments... arguments)
+	{
+		const auto state = receiver.get();
+		Clock::duration delay;
+
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+
+			state->latest = [state, arguments...]() mutable
+			{
+				state->callback(arguments...);
+			};
+
+			if (state->posted)
+				return;
+
+			state->posted = true;
+			delay = state->time + interval - Clock::now();
+		}
+
+		const std::weak_ptr<State> weakReceiver = receiver;
+
+		post([weakReceiver]()
+		{
+			const auto state = weakReceiver.lock();
+
+			if (!state)
+				return;
+
+			Event latest;
+			{
+				std::lock_guard<std::mutex> lock(state->mutex);
+				latest.swap(state->latest);
+				state->time = Clock::now();
+				state->posted = false;
+			}
+
+			latest();
+		}, delay);
+	};
+}
+
+template <typename... Arguments>
+std::function<void(Arguments...)> Dispatcher::debounced(std::function<void(Arguments...)> callback, Clock::duration interval)
+{
+	typedef RateLimited<Arguments...> State;
+
+	const auto receiver = std::make_shared<State>();
+	receiver->callback = std::move(callback);
+	receiver->posted = false;
+
+	return [this, receiver, interval](Arguments... arguments)
+	{
+		const auto state = receiver.get();
+
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+
+			state->latest = [state, arguments...]() mutable
+			{
+				state->callback(arguments...);
+			};
+
+			// time when the callback is due
+			state->time = Clock::now() + interval;
+
+			if (state->posted)
+				return;
+
+			state->posted = true;
+		}
+
+		postDebounced(std::weak_ptr<State>(receiver), interval);
+	};
+}
+
+template <typename... Arguments>
+void Dispatcher::postDebounced(std::weak_ptr<RateLimited<Arguments...>> receiver, Clock::duration delay)
+{
+	post([this, receiver]()
+	{
+		const auto state = receiver.lock();
+
+		if (!state)
+			return;
+
+		Event latest;
+		Clock::duration remaining;
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+
+			remaining = state->time - Clock::now();
+
+			if (remaining <= Clock::duration::zero())
+			{
+				latest.swap(state->latest);
+				state->posted = false;
+			}
+		}
+
+		if (latest)
+			latest();
+		else
+			postDebounced(receiver, remaining);
+	}, delay);
+}
+
+} // namespace signalzeug
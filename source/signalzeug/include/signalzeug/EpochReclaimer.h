@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <signalzeug/signalzeug_api.h>
+
+
+namespace signalzeug
+{
+
+/** \brief Defers destroying replaced data until no reader can access it anymore (epoch-based, RCU-style reclamation).
+
+	Readers announce themselves with a ReadGuard, which only increments a counter
+	of the current epoch. Writers publish a new version of the data, then retire
+	the old one. Retired data is destroyed once all readers that could have
+	seen it are gone. Writers never wait for readers, so a reader can write as well,
+	e.g., a slot that disconnects itself while its signal is being fired.
+
+	Writers must be serialized by the caller.
+*/
+class SIGNALZEUG_API EpochReclaimer
+{
+public:
+	class SIGNALZEUG_API ReadGuard
+	{
+	public:
+		explicit ReadGuard(const EpochReclaimer & reclaimer);
+		~ReadGuard();
+
+		ReadGuard(const ReadGuard &) = delete;
+		ReadGuard & operator=(const ReadGuard &) = delete;
+
+	protected:
+		const EpochReclaimer & m_reclaimer;
+		unsigned m_parity;
+	};
+
+public:
+	EpochReclaimer();
+	/** Destroys all retired data; there must not be any readers left. */
+	~EpochReclaimer();
+
+	EpochReclaimer(const EpochReclaimer &) = delete;
+	EpochReclaimer & operator=(const EpochReclaimer &) = delete;
+
+	/** Calls destroy once readers that may access the unpublished data are gone. */
+	void retire(std::function<void()> destroy);
+
+protected:
+	struct Retired
+	{
+		std::uint64_t epoch;
+		std::function<void()> destroy;
+	};
+
+	void reclaim();
+
+protected:
+	mutable std::atomic<std::uint64_t> m_epoch;
+	mutable std::atomic<unsigned> m_readers[2];
+	std::vector<Retired> m_retired;
+};
+
+} // namespace signalzeug
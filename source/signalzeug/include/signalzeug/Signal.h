@@ -1,15 +1,29 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
-#include <unordered_map>
+#include <vector>
 
 #include <signalzeug/signalzeug_api.h>
 #include <signalzeug/AbstractSignal.h>
+#include <signalzeug/Dispatcher.h>
+#include <signalzeug/SignalBatch.h>
+#include <signalzeug/Trackable.h>
 
 
 namespace signalzeug
 {
 
+/** \brief Calls all connected callbacks (slots) when fired.
+
+	Slots are stored contiguously in connection order and are called in place, in
+	that order. Disconnecting a slot leaves a tombstone that is removed lazily, so
+	neither fire() nor disconnecting allocates. Slots connected while the signal is
+	being fired are called from the next fire() on. Within a SignalBatch, fires are
+	deferred and coalesced. Slots of destroyed Trackable receivers are skipped and removed.
+
+	Signal is not thread-safe; see ConcurrentSignal for signals shared between threads.
+*/
 template <typename... Arguments>
 class Signal : public AbstractSignal
 {
@@ -17,13 +31,22 @@ public:
 	typedef std::function<void(Arguments...)> Callback;
 
 	Signal();
+	/** A copy starts without slots, like any AbstractSignal, and copies whether the signal is blocked. */
+	Signal(const Signal & signal);
+	/** Copies whether the signal is blocked; the slots of this signal stay connected. */
+	Signal & operator=(const Signal & signal);
 
 	void fire(Arguments... arguments);
 	void operator()(Arguments... arguments);
 
 	Connection connect(Callback callback) const;
+	/** Queued connection: the callback is called from dispatcher.processEvents(), which has to outlive the connection. */
+	Connection connect(Callback callback, Dispatcher & dispatcher, Delivery delivery = Delivery::Queued) const;
+	/** The callback is disconnected once receiver is destroyed. */
+	Connection connect(Callback callback, const Trackable & receiver) const;
 	Connection connect(Signal & signal) const;
 
+    /** If T is Trackable, the slot is disconnected once object is destroyed. */
     template <class T>
 	Connection connect(T * object, void (T::*method)(Arguments...)) const;
 
@@ -33,10 +56,36 @@ public:
 	Connection onFire(std::function<void()> callback) const;
 
 protected:
+	struct Slot
+	{
+		Connection::Id id;
+		bool connected;
+		Callback callback;
+		// the receiver's tracker, if it is Trackable
+		std::shared_ptr<const Tracker> tracker;
+	};
+
+	Connection connect(Callback callback, std::shared_ptr<const Tracker> tracker) const;
+
+	// records the fire in the current SignalBatch if the arguments can be copied, see IsBatchable
+	bool record(std::true_type batchable, Arguments &... arguments);
+	bool record(std::false_type batchable, Arguments &... arguments);
+
 	virtual void disconnectId(Connection::Id id) const override;
 
+	// finds the slot by binary search, as slots are ordered by id
+	Slot * findSlot(std::vector<Slot> & slots, Connection::Id id) const;
+
+	// merges slots connected while firing, releases the callbacks of tombstones and removes them once they make up half of the slots
+	void tidy() const;
+
 protected:
-	mutable std::unordered_map<Connection::Id, Callback> m_callbacks;
+	mutable std::vector<Slot> m_slots;
+	mutable std::vector<Slot> m_pending;
+	mutable std::size_t m_tombstones;
+	// whether tombstones left while firing still hold their callbacks
+	mutable bool m_unreleased;
+	mutable unsigned m_firing;
 	bool m_blocked;
 };
 
@@ -2,28 +2,109 @@
 
 #include <signalzeug/Signal.h>
 
+#include <signalzeug/profiling.h>
+
+#include <algorithm>
+#include <iterator>
+
 namespace signalzeug
 {
 
 template <typename... Arguments>
 Signal<Arguments...>::Signal()
-: m_blocked(false)
+: m_tombstones(0)
+, m_unreleased(false)
+, m_firing(0)
+, m_blocked(false)
+{
+}
+
+template <typename... Arguments>
+Signal<Arguments...>::Signal(const Signal & signal)
+: AbstractSignal(signal)
+, m_tombstones(0)
+, m_unreleased(false)
+, m_firing(0)
+, m_blocked(signal.m_blocked)
 {
 }
 
+template <typename... Arguments>
+Signal<Arguments...> & Signal<Arguments...>::operator=(const Signal & signal)
+{
+	AbstractSignal::operator=(signal);
+	m_blocked = signal.m_blocked;
+
+	return *this;
+}
+
 template <typename... Arguments>
 void Signal<Arguments...>::fire(Arguments... arguments)
 {
 	if (m_blocked)
 		return;
-	
-	for (auto & pair : m_callbacks)
+
+	if (SignalBatch::active() && record(IsBatchable<Arguments...>(), arguments...))
+		return;
+
+	SIGNALZEUG_PROFILE_FIRE(this);
+
+	struct Firing
+	{
+		~Firing()
+		{
+			if (--signal.m_firing == 0)
+				signal.tidy();
+		}
+
+		const Signal & signal;
+	};
+
+	++m_firing;
+	Firing firing{ *this };
+
+	// slots connected meanwhile go to m_pending, so m_slots does not reallocate
+	const auto size = m_slots.size();
+
+	for (std::size_t i = 0; i < size; ++i)
 	{
-		Callback callback = pair.second;
-		callback(arguments...);
+		auto & slot = m_slots[i];
+
+		if (!slot.connected)
+			continue;
+
+		// the receiver is gone, so the slot is disconnected; it is removed once firing is done
+		if (slot.tracker && !slot.tracker->alive())
+		{
+			slot.connected = false;
+			++m_tombstones;
+			m_unreleased = true;
+			continue;
+		}
+
+		SIGNALZEUG_PROFILE_SLOT(this, slot.id);
+		slot.callback(arguments...);
 	}
 }
 
+template <typename... Arguments>
+bool Signal<Arguments...>::record(std::true_type /*batchable*/, Arguments &... arguments)
+{
+	// the arguments are captured by value, also those passed by const reference
+	SignalBatch::record(this, [this, arguments...]() mutable
+	{
+		fire(arguments...);
+	});
+
+	return true;
+}
+
+template <typename... Arguments>
+bool Signal<Arguments...>::record(std::false_type /*batchable*/, Arguments &... /*arguments*/)
+{
+	return false;
+}
+
 template <typename... Arguments>
 void Signal<Arguments...>::operator()(Arguments... arguments)
 {
@@ -32,12 +113,33 @@ void Signal<Arguments...>::operator()(Arguments... arguments)
 
 template <typename... Arguments>
 Connection Signal<Arguments...>::connect(Callback callback) const
+{
+	return connect(std::move(callback), nullptr);
+}
+
+template <typename... Arguments>
+Connection Signal<Arguments...>::connect(Callback callback, const Trackable & receiver) const
+{
+	return connect(std::move(callback), receiver.tracker());
+}
+
+template <typename... Arguments>
+Connection Signal<Arguments...>::connect(Callback callback, std::shared_ptr<const Tracker> tracker) const
 {
 	Connection connection = createConnection();
-	m_callbacks[connection.id()] = callback;
+
+	auto & slots = m_firing > 0 ? m_pending : m_slots;
+	slots.push_back(Slot{ connection.id(), true, std::move(callback), std::move(tracker) });
+
 	return connection;
 }
 
+template <typename... Arguments>
+Connection Signal<Arguments...>::connect(Callback callback, Dispatcher & dispatcher, Delivery delivery) const
+{
+	return connect(dispatcher.queued(std::move(callback), delivery));
+}
+
 template <typename... Arguments>
 template <class T>
 Connection Signal<Arguments...>::connect(T * object, void (T::*method)(Arguments...)) const
@@ -45,7 +147,7 @@ Connection Signal<Arguments...>::connect(T * object, void (T::*method)(Arguments
 	return connect([object, method](Arguments... arguments) 
 	{
 		(object->*method)(arguments...);
-	});
+	}, trackerOf(object));
 }
 
 template <typename... Arguments>
@@ -81,7 +183,78 @@ void Signal<Arguments...>::unblock()
 template <typename... Arguments>
 void Signal<Arguments...>::disconnectId(Connection::Id id) const
 {
-	m_callbacks.erase(id);
+	auto slot = findSlot(m_slots, id);
+
+	if (!slot)
+	{
+		slot = findSlot(m_pending, id);
+
+		if (!slot)
+			return;
+	}
+
+	slot->connected = false;
+	++m_tombstones;
+
+	// a slot being called must not be destroyed before it returns, so it is released once firing is done
+	if (m_firing > 0)
+	{
+		m_unreleased = true;
+		return;
+	}
+
+	slot->callback = nullptr;
+	slot->tracker.reset();
+	tidy();
+}
+
+template <typename... Arguments>
+typename Signal<Arguments...>::Slot * Signal<Arguments...>::findSlot(std::vector<Slot> & slots, Connection::Id id) const
+{
+	const auto slot = std::lower_bound(slots.begin(), slots.end(), id, [] (const Slot & candidate, Connection::Id value)
+	{
+		return candidate.id < value;
+	});
+
+	if (slot == slots.end() || slot->id != id || !slot->connected)
+		return nullptr;
+
+	return &*slot;
+}
+
+template <typename... Arguments>
+void Signal<Arguments...>::tidy() const
+{
+	if (!m_pending.empty())
+	{
+		m_slots.insert(m_slots.end(), std::make_move_iterator(m_pending.begin()), std::make_move_iterator(m_pending.end()));
+		m_pending.clear();
+	}
+
+	// tombstones must not keep alive what their callbacks captured, e.g., the queued events of a Dispatcher
+	if (m_unreleased)
+	{
+		for (auto & slot : m_slots)
+		{
+			if (!slot.connected)
+			{
+				slot.callback = nullptr;
+				slot.tracker.reset();
+			}
+		}
+
+		m_unreleased = false;
+	}
+
+	if (m_tombstones * 2 < m_slots.size())
+		return;
+
+	m_slots.erase(std::remove_if(m_slots.begin(), m_slots.end(), [] (const Slot & slot)
+	{
+		return !slot.connected;
+	}), m_slots.end());
+
+	m_tombstones = 0;
 }
 
 } // namespace signalzeug
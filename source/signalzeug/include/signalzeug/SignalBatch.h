@@ -0,0 +1,81 @@
+#pragma once
+
+#include <functional>
+#include <type_traits>
+
+#include <signalzeug/signalzeug_api.h>
+
+
+namespace signalzeug
+{
+
+class AbstractSignal;
+
+/** Whether fires of a Signal with these argument types can be deferred by a SignalBatch,
+	i.e., none is a non-const reference and all can be copied.
+*/
+template <typename... Arguments>
+struct IsBatchable : std::true_type
+{
+};
+
+template <typename Argument, typename... Arguments>
+struct IsBatchable<Argument, Arguments...> : std::integral_constant<bool,
+	!(std::is_lvalue_reference<Argument>::value && !std::is_const<typename std::remove_reference<Argument>::type>::value)
+	&& std::is_copy_constructible<typename std::decay<Argument>::type>::value
+	&& IsBatchable<Arguments...>::value>
+{
+};
+
+/** \brief Scope that defers and coalesces the fires of all Signals on the current thread.
+
+	While a SignalBatch exists, Signal::fire() only records its arguments. When the outermost
+	batch of the thread ends, every signal fired in it is fired once more, with the arguments
+	of its last fire, in the order the signals were first fired. Slots thus run once per signal
+	instead of once per change, e.g., when setting many properties in a row:
+
+	\code{.cpp}
+
+		{
+			SignalBatch batch;
+
+			for (auto property : properties)
+				property->setValue(0);
+
+		} // each valueChanged signal is fired here, once
+
+	\endcode
+
+	Fires caused by the delivered slots are not deferred anymore. Recording a fire copies its
+	arguments, also those passed by const reference, so the slots receive references to the
+	copies. Signals whose arguments cannot be copied that way, or that are passed by non-const
+	reference, e.g., for slots to return results through, are never deferred but fired right
+	away (see IsBatchable). Blocked signals are not recorded. Batches are per thread and do
+	not affect ConcurrentSignal.
+
+	Slots should not throw when the batch is left by its destructor; call flush() first
+	if they may.
+*/
+class SIGNALZEUG_API SignalBatch
+{
+public:
+	SignalBatch();
+	~SignalBatch();
+
+	SignalBatch(const SignalBatch &) = delete;
+	SignalBatch & operator=(const SignalBatch &) = delete;
+
+	/** Fires the signals recorded so far, if this is the outermost batch. */
+	void flush();
+
+	/** True if fires on the current thread are deferred. */
+	static bool active();
+
+	/** Records delivery for the signal, replacing a previously recorded one. */
+	static void record(const AbstractSignal * signal, std::function<void()> delivery);
+
+	/** Drops a recorded delivery, e.g., since the signal is destroyed. */
+	static void discard(const AbstractSignal * signal);
+};
+
+} // namespace signalzeug
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <signalzeug/signalzeug_api.h>
+#include <signalzeug/Connection.h>
+
+
+namespace signalzeug
+{
+
+class AbstractSignal;
+
+/** Fires of one signal, accumulated over all threads while recording. */
+struct SignalRecord
+{
+	const AbstractSignal * signal;
+	std::string name;
+
+	std::uint64_t fires;
+	/** Time spent in its slots, including signals fired by them */
+	std::uint64_t slotNanoseconds;
+};
+
+/** Calls of one slot, accumulated over all threads while recording. */
+struct SlotRecord
+{
+	const AbstractSignal * signal;
+	std::string name;
+	Connection::Id connection;
+
+	std::uint64_t calls;
+	std::uint64_t totalNanoseconds;
+	std::uint64_t maxNanoseconds;
+	/** Calls during which the slot connected or disconnected slots of its own signal */
+	std::uint64_t reconnects;
+};
+
+/** \brief Records which signals are fired how often and which slots make fire() slow.
+
+	Instrumentation is compiled in with OPTION_SIGNALZEUG_PROFILING only (see available()),
+	which defines SIGNALZEUG_PROFILING for signalzeug and all code using it. Otherwise,
+	signals contain no instrumentation at all and recording yields empty reports.
+
+	When compiled in but not recording, each fire and slot call only adds a relaxed atomic
+	load and a branch, both inlined into fire(), so that profiling can be enabled in
+	production builds and started on demand.
+	While recording, every thread accumulates its own statistics.
+
+	\code{.cpp}
+
+		SignalProfiler::setName(property.valueChanged, "property.valueChanged");
+
+		SignalProfiler::start();
+		updateScene();
+		SignalProfiler::stop();
+
+		SignalProfiler::writeReport(std::cout);
+
+	\endcode
+
+	Signals are identified by their address, so the records of a destroyed signal may
+	be merged with those of a signal created at the same address later.
+*/
+class SIGNALZEUG_API SignalProfiler
+{
+public:
+	/** Returns whether instrumentation is compiled in. */
+	static bool available();
+
+	/** Discards previous recordings and starts recording. */
+	static void start();
+	static void stop();
+	static bool recording();
+
+	/** Names the signal in reports. */
+	static void setName(const AbstractSignal & signal, const std::string & name);
+
+	/** Returns the signals fired since start(), the most expensive first. */
+	static std::vector<SignalRecord> signals();
+	/** Returns the slots called since start(), the most expensive first. */
+	static std::vector<SlotRecord> slots();
+
+	/** Writes both as tables; slots that reconnected while being called are flagged. */
+	static void writeReport(std::ostream & stream);
+	static bool writeReport(const std::string & fileName);
+};
+
+} // namespace signalzeug
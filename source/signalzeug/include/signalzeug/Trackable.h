@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <signalzeug/signalzeug_api.h>
+
+
+namespace signalzeug
+{
+
+/** \brief Tells whether a Trackable still exists; shared by the Trackable and the slots calling it. */
+class SIGNALZEUG_API Tracker
+{
+public:
+	Tracker();
+
+	bool alive() const
+	{
+		return m_alive.load(std::memory_order_acquire);
+	}
+
+	void expire();
+
+protected:
+	std::atomic<bool> m_alive;
+};
+
+/** \brief Base class for receivers whose slots are disconnected automatically when they are destroyed.
+
+	Slots connected with Signal::connect(object, &T::method) for a T derived from Trackable,
+	or with Signal::connect(callback, receiver), check whether the receiver still exists with
+	a single atomic load before each call. Once it is destroyed, the slots are skipped and
+	removed, so no ConnectionMap or ScopedConnection is required.
+
+	\code{.cpp}
+
+		class View : public Trackable
+		{
+		public:
+			void update(int value);
+		};
+
+		auto view = new View;
+		property.valueChanged.connect(view, &View::update);
+
+		delete view; // property.valueChanged does not call view anymore
+
+	\endcode
+
+	Destroying a receiver while one of its slots is being called on another thread is not
+	guarded against, just as with any other slot.
+*/
+class SIGNALZEUG_API Trackable
+{
+public:
+	const std::shared_ptr<Tracker> & tracker() const;
+
+protected:
+	Trackable();
+	/** A copy is a different receiver, thus with its own tracker. */
+	Trackable(const Trackable & trackable);
+	~Trackable();
+
+	Trackable & operator=(const Trackable & trackable);
+
+protected:
+	std::shared_ptr<Tracker> m_tracker;
+};
+
+/** The tracker of the object, or nullptr if it is not Trackable. */
+inline std::shared_ptr<const Tracker> trackerOf(const Trackable * object)
+{
+	return object->tracker();
+}
+
+inline std::shared_ptr<const Tracker> trackerOf(const void * /*object*/)
+{
+	return nullptr;
+}
+
+} // namespace signalzeug
@@ -0,0 +1,103 @@
+#pragma once
+
+/*  Instrumentation hooks of signals, see SignalProfiler.
+	Without SIGNALZEUG_PROFILING they expand to nothing. Since signals are templates,
+	code firing them has to be compiled with the same setting as signalzeug.
+*/
+
+#ifdef SIGNALZEUG_PROFILING
+
+#include <atomic>
+#include <cstdint>
+
+#include <signalzeug/signalzeug_api.h>
+#include <signalzeug/Connection.h>
+
+namespace signalzeug
+{
+
+class AbstractSignal;
+
+namespace profiling
+{
+
+// set by SignalProfiler::start() and stop(); read inline, so that hooks cost a single load while not recording
+SIGNALZEUG_API extern std::atomic<bool> s_recording;
+
+inline bool recording()
+{
+	return s_recording.load(std::memory_order_relaxed);
+}
+
+// the hooks below are called while recording only
+SIGNALZEUG_API void fired(const AbstractSignal * signal);
+
+// a connection of the signal was made or broken, possibly by one of its slots
+SIGNALZEUG_API void connectionsChanged(const AbstractSignal * signal);
+
+/*  Measures a slot call while in scope; does nothing if recording is not
+	active on construction.
+*/
+class SIGNALZEUG_API SlotScope
+{
+public:
+	SlotScope(const AbstractSignal * signal, Connection::Id id)
+	: m_signal(signal)
+	, m_id(id)
+	, m_active(recording())
+	, m_reconnected(false)
+	, m_begin(0)
+	, m_previous(nullptr)
+	{
+		if (m_active)
+			begin();
+	}
+
+	~SlotScope()
+	{
+		if (m_active)
+			end();
+	}
+
+	SlotScope(const SlotScope &) = delete;
+	SlotScope & operator=(const SlotScope &) = delete;
+
+	const AbstractSignal * signal() const;
+	SlotScope * previous() const;
+
+	void reconnected();
+
+protected:
+	void begin();
+	void end();
+
+protected:
+	const AbstractSignal * m_signal;
+	Connection::Id m_id;
+	bool m_active;
+	bool m_reconnected;
+	std::uint64_t m_begin;
+	// enclosing slot call on this thread
+	SlotScope * m_previous;
+};
+
+} // namespace profiling
+
+} // namespace signalzeug
+
+#define SIGNALZEUG_PROFILE_CONCAT_(a, b) a##b
+#define SIGNALZEUG_PROFILE_CONCAT(a, b) SIGNALZEUG_PROFILE_CONCAT_(a, b)
+
+#define SIGNALZEUG_PROFILE_FIRE(signal) \
+	do { if (signalzeug::profiling::recording()) signalzeug::profiling::fired(signal); } while (false)
+#define SIGNALZEUG_PROFILE_SLOT(signal, id) signalzeug::profiling::SlotScope SIGNALZEUG_PROFILE_CONCAT(profileScope, __LINE__)(signal, id)
+#define SIGNALZEUG_PROFILE_RECONNECT(signal) \
+	do { if (signalzeug::profiling::recording()) signalzeug::profiling::connectionsChanged(signal); } while (false)
+
+#else
+
+#define SIGNALZEUG_PROFILE_FIRE(signal)
+#define SIGNALZEUG_PROFILE_SLOT(signal, id)
+#define SIGNALZEUG_PROFILE_RECONNECT(signal)
+
+#endif
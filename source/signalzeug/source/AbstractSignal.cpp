@@ -1,35 +1,50 @@
 
 #include <signalzeug/AbstractSignal.h>
 
+#include <signalzeug/SignalBatch.h>
+#include <signalzeug/profiling.h>
+
+#include "SignalRegistry.h"
+
 namespace signalzeug
 {
 
 AbstractSignal::AbstractSignal()
-: m_nextId(1)
+: m_index(SignalRegistry::instance().allocate(this))
+, m_generation(SignalRegistry::instance().entry(m_index).generation.load())
+, m_nextId(1)
+{
+}
+
+AbstractSignal::AbstractSignal(const AbstractSignal & /*signal*/)
+: AbstractSignal()
 {
 }
 
 AbstractSignal::~AbstractSignal()
 {
-	for (std::pair<Connection::Id, Connection> pair: m_connections)
-	{
-		Connection & connection = pair.second;
-		connection.detach();
-	}
+	SignalBatch::discard(this);
+
+	// invalidates all connections at once
+	SignalRegistry::instance().release(m_index);
+}
+
+AbstractSignal & AbstractSignal::operator=(const AbstractSignal & /*signal*/)
+{
+	return *this;
 }
 
 Connection AbstractSignal::createConnection() const
 {
-	Connection::Id id = m_nextId++;
-	Connection connection(this, id);
-	m_connections[id] = connection;
+	SIGNALZEUG_PROFILE_RECONNECT(this);
 
-	return connection;
+	return Connection(m_index, m_generation, m_nextId++);
 }
 
 void AbstractSignal::disconnect(Connection & connection) const
 {
-	m_connections.erase(connection.id());
+	SIGNALZEUG_PROFILE_RECONNECT(this);
+
 	disconnectId(connection.id());
 }
 
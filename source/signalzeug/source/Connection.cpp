@@ -2,38 +2,42 @@
 #include <signalzeug/Connection.h>
 #include <signalzeug/AbstractSignal.h>
 
+#include "SignalRegistry.h"
+
 namespace signalzeug
 {
 
 Connection::Connection()
+:   m_index(0)
+,   m_generation(0)
+,   m_id(0)
 {
 }
 
-Connection::Connection(const AbstractSignal * signal, Id id)
-:   m_state(new State { signal, id })
+Connection::Connection(std::uint32_t index, std::uint32_t generation, Id id)
+:   m_index(index)
+,   m_generation(generation)
+,   m_id(id)
 {
 }
 
 Connection::Id Connection::id() const
 {
-	return m_state ? m_state->id : 0;
+	return m_id;
 }
 
 void Connection::disconnect()
 {
-    if (m_state && m_state->signal)
-	{
-		m_state->signal->disconnect(*this);
-		detach();
-	}
-}
+    if (m_index == 0)
+		return;
 
-void Connection::detach()
-{
-	if (m_state)
-	{
-		m_state->signal = nullptr;
-	}
+	const auto & entry = SignalRegistry::instance().entry(m_index);
+
+	// disconnecting twice is harmless, but a destroyed signal must not be accessed
+	if (entry.generation.load() == m_generation)
+		entry.signal->disconnect(*this);
+
+	m_index = 0;
 }
 
 } // namespace signalzeug
@@ -0,0 +1,171 @@
+
+#include <signalzeug/Dispatcher.h>
+
+#include <algorithm>
+
+namespace signalzeug
+{
+
+Dispatcher::Dispatcher()
+: m_timerSequence(0)
+, m_interrupted(false)
+{
+}
+
+Dispatcher::~Dispatcher()
+{
+}
+
+Dispatcher & Dispatcher::current()
+{
+	static thread_local Dispatcher dispatcher;
+	return dispatcher;
+}
+
+void Dispatcher::post(Event event)
+{
+	std::shared_ptr<std::function<void()>> wakeUp;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_events.empty())
+			wakeUp = m_wakeUp;
+
+		m_events.push_back(std::move(event));
+	}
+
+	m_condition.notify_one();
+
+	// called without the lock, as it may post or process events itself
+	if (wakeUp)
+		(*wakeUp)();
+}
+
+void Dispatcher::post(Event event, Clock::duration delay)
+{
+	if (delay <= Clock::duration::zero())
+	{
+		post(std::move(event));
+		return;
+	}
+
+	std::shared_ptr<std::function<void()>> wakeUp;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const auto sequence = m_timerSequence++;
+		m_timers.push_back(Timer{ Clock::now() + delay, sequence, std::move(event) });
+		std::push_heap(m_timers.begin(), m_timers.end(), &Dispatcher::later);
+
+		// the event loop has to update its remainingTime() if the new timer is the next one due
+		if (m_events.empty() && m_timers.front().sequence == sequence)
+			wakeUp = m_wakeUp;
+	}
+
+	m_condition.notify_one();
+
+	if (wakeUp)
+		(*wakeUp)();
+}
+
+std::size_t Dispatcher::processEvents()
+{
+	std::vector<Event> batch;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		batch.swap(m_events);
+
+		const auto now = Clock::now();
+
+		while (!m_timers.empty() && m_timers.front().due <= now)
+		{
+			std::pop_heap(m_timers.begin(), m_timers.end(), &Dispatcher::later);
+			batch.push_back(std::move(m_timers.back().event));
+			m_timers.pop_back();
+		}
+	}
+
+	for (auto & event : batch)
+		event();
+
+	const auto count = batch.size();
+
+	// hand the buffer back, so that posting does not allocate in the steady state
+	batch.clear();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_events.empty() && m_events.capacity() < batch.capacity())
+			m_events.swap(batch);
+	}
+
+	return count;
+}
+
+bool Dispatcher::hasPendingEvents() const
+{
+	return remainingTime() == Clock::duration::zero();
+}
+
+Dispatcher::Clock::duration Dispatcher::remainingTime() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (!m_events.empty())
+		return Clock::duration::zero();
+
+	if (m_timers.empty())
+		return Clock::duration::max();
+
+	return std::max(m_timers.front().due - Clock::now(), Clock::duration::zero());
+}
+
+void Dispatcher::waitForEvents()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	while (m_events.empty() && !m_interrupted)
+	{
+		if (m_timers.empty())
+		{
+			m_condition.wait(lock);
+			continue;
+		}
+
+		const auto due = m_timers.front().due;
+
+		if (m_condition.wait_until(lock, due) == std::cv_status::timeout || Clock::now() >= due)
+			break;
+	}
+
+	m_interrupted = false;
+}
+
+void Dispatcher::interrupt()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_interrupted = true;
+	}
+
+	m_condition.notify_all();
+}
+
+void Dispatcher::setWakeUp(std::function<void()> wakeUp)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_wakeUp = wakeUp ? std::make_shared<std::function<void()>>(std::move(wakeUp)) : nullptr;
+}
+
+bool Dispatcher::later(const Timer & timer, const Timer & other)
+{
+	if (timer.due != other.due)
+		return timer.due > other.due;
+
+	return timer.sequence > other.sequence;
+}
+
+} // namespace signalzeug
@@ -0,0 +1,78 @@
+
+#include <signalzeug/EpochReclaimer.h>
+
+#include <algorithm>
+
+namespace signalzeug
+{
+
+EpochReclaimer::ReadGuard::ReadGuard(const EpochReclaimer & reclaimer)
+: m_reclaimer(reclaimer)
+, m_parity(0)
+{
+	// a reader counts for an epoch only if the epoch did not advance while it registered
+	while (true)
+	{
+		const auto epoch = m_reclaimer.m_epoch.load();
+		m_parity = static_cast<unsigned>(epoch & 1);
+
+		++m_reclaimer.m_readers[m_parity];
+
+		if (m_reclaimer.m_epoch.load() == epoch)
+			break;
+
+		--m_reclaimer.m_readers[m_parity];
+	}
+}
+
+EpochReclaimer::ReadGuard::~ReadGuard()
+{
+	--m_reclaimer.m_readers[m_parity];
+}
+
+EpochReclaimer::EpochReclaimer()
+: m_epoch(0)
+{
+	m_readers[0] = 0;
+	m_readers[1] = 0;
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+	for (auto & retired : m_retired)
+		retired.destroy();
+}
+
+void EpochReclaimer::retire(std::function<void()> destroy)
+{
+	m_retired.push_back(Retired{ m_epoch.load(), std::move(destroy) });
+	reclaim();
+}
+
+void EpochReclaimer::reclaim()
+{
+	auto epoch = m_epoch.load();
+
+	// the epoch may only advance once the readers of the previous epoch with the same parity are gone
+	if (m_readers[(epoch + 1) & 1] == 0)
+		m_epoch = ++epoch;
+
+	// data retired in epoch e can only be held by readers of epochs up to e
+	const auto reclaimable = [this, epoch] (const Retired & retired)
+	{
+		return epoch >= retired.epoch + 2
+			|| (epoch == retired.epoch + 1 && m_readers[retired.epoch & 1] == 0);
+	};
+
+	const auto kept = std::stable_partition(m_retired.begin(), m_retired.end(), [&reclaimable] (const Retired & retired)
+	{
+		return !reclaimable(retired);
+	});
+
+	for (auto i = kept; i != m_retired.end(); ++i)
+		i->destroy();
+
+	m_retired.erase(kept, m_retired.end());
+}
+
+} // namespace signalzeug
@@ -0,0 +1,168 @@
+
+#include <signalzeug/SignalBatch.h>
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace signalzeug
+{
+
+namespace
+{
+
+struct Recorded
+{
+	std::vector<std::pair<const AbstractSignal *, std::function<void()>>> deliveries;
+	std::unordered_map<const AbstractSignal *, std::size_t> index;
+};
+
+struct Delivering
+{
+	Recorded recorded;
+	Delivering * previous;
+};
+
+struct BatchState
+{
+	BatchState()
+	: depth(0)
+	, delivering(nullptr)
+	{
+	}
+
+	unsigned depth;
+	Recorded recorded;
+	// deliveries being flushed; slots may start batches of their own meanwhile
+	Delivering * delivering;
+};
+
+// trivially destructible, so signals destroyed after the thread's batch state (e.g., statics) can still check it
+thread_local BatchState * t_batch = nullptr;
+
+struct BatchStateOwner
+{
+	~BatchStateOwner()
+	{
+		t_batch = nullptr;
+	}
+
+	BatchState batchState;
+};
+
+BatchState & state()
+{
+	if (!t_batch)
+	{
+		static thread_local BatchStateOwner owner;
+		t_batch = &owner.batchState;
+	}
+
+	return *t_batch;
+}
+
+void drop(Recorded & recorded, const AbstractSignal * signal)
+{
+	const auto i = recorded.index.find(signal);
+
+	if (i == recorded.index.end())
+		return;
+
+	recorded.deliveries[i->second].second = nullptr;
+	recorded.index.erase(i);
+}
+
+} // namespace
+
+
+SignalBatch::SignalBatch()
+{
+	++state().depth;
+}
+
+SignalBatch::~SignalBatch()
+{
+	flush();
+	--state().depth;
+}
+
+void SignalBatch::flush()
+{
+	auto & batch = state();
+
+	if (batch.depth != 1 || batch.recorded.deliveries.empty())
+		return;
+
+	struct Flush
+	{
+		Flush(BatchState & batch)
+		: batch(batch)
+		{
+			delivering.recorded = std::move(batch.recorded);
+			delivering.previous = batch.delivering;
+
+			batch.recorded = Recorded();
+			batch.delivering = &delivering;
+			batch.depth = 0;
+		}
+
+		~Flush()
+		{
+			batch.delivering = delivering.previous;
+			batch.depth = 1;
+		}
+
+		BatchState & batch;
+		Delivering delivering;
+	};
+
+	Flush flush(batch);
+	auto & recorded = flush.delivering.recorded;
+
+	for (auto & delivery : recorded.deliveries)
+	{
+		if (!delivery.second)
+			continue;
+
+		recorded.index.erase(delivery.first);
+
+		// moved out, as the slots may destroy the signal and thus discard its delivery
+		const auto deliver = std::move(delivery.second);
+		deliver();
+	}
+}
+
+bool SignalBatch::active()
+{
+	return t_batch && t_batch->depth > 0;
+}
+
+void SignalBatch::record(const AbstractSignal * signal, std::function<void()> delivery)
+{
+	auto & recorded = state().recorded;
+	const auto i = recorded.index.find(signal);
+
+	if (i != recorded.index.end())
+	{
+		recorded.deliveries[i->second].second = std::move(delivery);
+		return;
+	}
+
+	recorded.index.emplace(signal, recorded.deliveries.size());
+	recorded.deliveries.emplace_back(signal, std::move(delivery));
+}
+
+void SignalBatch::discard(const AbstractSignal * signal)
+{
+	if (!t_batch || (t_batch->depth == 0 && !t_batch->delivering))
+		return;
+
+	auto & batch = *t_batch;
+
+	drop(batch.recorded, signal);
+
+	for (auto delivering = batch.delivering; delivering; delivering = delivering->previous)
+		drop(delivering->recorded, signal);
+}
+
+} // namespace signalzeug
@@ -0,0 +1,456 @@
+
+#include <signalzeug/SignalProfiler.h>
+
+#include <fstream>
+#include <ostream>
+
+#include <signalzeug/profiling.h>
+
+#ifdef SIGNALZEUG_PROFILING
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#endif
+
+
+#ifdef SIGNALZEUG_PROFILING
+
+namespace
+{
+
+using signalzeug::AbstractSignal;
+using signalzeug::Connection;
+using signalzeug::SignalRecord;
+using signalzeug::SlotRecord;
+using signalzeug::profiling::SlotScope;
+
+struct SlotKey
+{
+	const AbstractSignal * signal;
+	Connection::Id id;
+
+	bool operator==(const SlotKey & other) const
+	{
+		return signal == other.signal && id == other.id;
+	}
+};
+
+struct SlotKeyHash
+{
+	std::size_t operator()(const SlotKey & key) const
+	{
+		return std::hash<const AbstractSignal *>()(key.signal) ^ (static_cast<std::size_t>(key.id) * 0x9e3779b9u);
+	}
+};
+
+struct SlotStatistics
+{
+	std::uint64_t calls;
+	std::uint64_t totalNanoseconds;
+	std::uint64_t maxNanoseconds;
+	std::uint64_t reconnects;
+};
+
+/*  Fire counts and slot timings gathered on one thread. Its thread updates them from
+	within fire(), reports only read them, so the mutex is practically always free.
+*/
+struct ThreadProfile
+{
+	ThreadProfile()
+	: alive(true)
+	{
+	}
+
+	bool alive;
+
+	std::mutex mutex;
+	std::unordered_map<const AbstractSignal *, std::uint64_t> fires;
+	std::unordered_map<SlotKey, SlotStatistics, SlotKeyHash> slots;
+};
+
+// profiles of all threads that fired while recording, and the names given to signals
+struct Registry
+{
+	std::mutex mutex;
+	std::vector<std::shared_ptr<ThreadProfile>> profiles;
+	std::unordered_map<const AbstractSignal *, std::string> names;
+};
+
+// leaked on purpose: signals of static objects may still be fired while other statics are destroyed
+Registry & registry()
+{
+	static auto registry = new Registry;
+	return *registry;
+}
+
+// slot durations are measured in nanoseconds of the steady clock
+std::uint64_t now()
+{
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/*  The registry keeps the profile of an exited thread, so that its statistics still
+	appear in reports; start() discards it once the thread marked it as dead.
+*/
+struct ProfileOwner
+{
+	~ProfileOwner()
+	{
+		if (!profile)
+			return;
+
+		std::lock_guard<std::mutex> lock(profile->mutex);
+		profile->alive = false;
+	}
+
+	std::shared_ptr<ThreadProfile> profile;
+};
+
+thread_local ProfileOwner t_profile;
+// innermost slot being called on this thread
+thread_local SlotScope * t_slot = nullptr;
+
+ThreadProfile & currentProfile()
+{
+	if (!t_profile.profile)
+	{
+		auto & registry = ::registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		t_profile.profile = std::make_shared<ThreadProfile>();
+		registry.profiles.push_back(t_profile.profile);
+	}
+
+	return *t_profile.profile;
+}
+
+// merges the statistics of all threads; the registry has to be locked
+void collect(std::unordered_map<const AbstractSignal *, SignalRecord> & signals, std::unordered_map<SlotKey, SlotRecord, SlotKeyHash> & slots)
+{
+	auto & registry = ::registry();
+
+	const auto nameOf = [&registry] (const AbstractSignal * signal)
+	{
+		const auto name = registry.names.find(signal);
+		return name != registry.names.end() ? name->second : std::string();
+	};
+
+	const auto signalRecord = [&] (const AbstractSignal * signal) -> SignalRecord &
+	{
+		auto record = signals.find(signal);
+
+		if (record == signals.end())
+			record = signals.emplace(signal, SignalRecord{ signal, nameOf(signal), 0, 0 }).first;
+
+		return record->second;
+	};
+
+	for (const auto & profile : registry.profiles)
+	{
+		std::lock_guard<std::mutex> lock(profile->mutex);
+
+		for (const auto & fires : profile->fires)
+			signalRecord(fires.first).fires += fires.second;
+
+		for (const auto & slot : profile->slots)
+		{
+			const auto & statistics = slot.second;
+
+			signalRecord(slot.first.signal).slotNanoseconds += statistics.totalNanoseconds;
+
+			auto record = slots.find(slot.first);
+
+			if (record == slots.end())
+				record = slots.emplace(slot.first, SlotRecord{ slot.first.signal, nameOf(slot.first.signal), slot.first.id, 0, 0, 0, 0 }).first;
+
+			record->second.calls += statistics.calls;
+			record->second.totalNanoseconds += statistics.totalNanoseconds;
+			record->second.maxNanoseconds = std::max(record->second.maxNanoseconds, statistics.maxNanoseconds);
+			record->second.reconnects += statistics.reconnects;
+		}
+	}
+}
+
+template <typename Map>
+std::vector<typename Map::mapped_type> values(const Map & records)
+{
+	std::vector<typename Map::mapped_type> result;
+	for (const auto & record : records)
+		result.push_back(record.second);
+	return result;
+}
+
+std::string label(const AbstractSignal * signal, const std::string & name)
+{
+	if (!name.empty())
+		return name;
+
+	std::ostringstream stream;
+	stream << static_cast<const void *>(signal);
+	return stream.str();
+}
+
+} // namespace
+
+
+namespace signalzeug
+{
+
+namespace profiling
+{
+
+std::atomic<bool> s_recording(false);
+
+void fired(const AbstractSignal * signal)
+{
+	auto & profile = currentProfile();
+
+	std::lock_guard<std::mutex> lock(profile.mutex);
+	++profile.fires[signal];
+}
+
+void connectionsChanged(const AbstractSignal * signal)
+{
+	for (auto slot = t_slot; slot; slot = slot->previous())
+	{
+		if (slot->signal() == signal)
+		{
+			slot->reconnected();
+			return;
+		}
+	}
+}
+
+void SlotScope::begin()
+{
+	m_previous = t_slot;
+	t_slot = this;
+
+	m_begin = now();
+}
+
+void SlotScope::end()
+{
+	const auto duration = now() - m_begin;
+
+	t_slot = m_previous;
+
+	auto & profile = currentProfile();
+
+	std::lock_guard<std::mutex> lock(profile.mutex);
+
+	auto & statistics = profile.slots[SlotKey{ m_signal, m_id }];
+	++statistics.calls;
+	statistics.totalNanoseconds += duration;
+	statistics.maxNanoseconds = std::max(statistics.maxNanoseconds, duration);
+
+	if (m_reconnected)
+		++statistics.reconnects;
+}
+
+const AbstractSignal * SlotScope::signal() const
+{
+	return m_signal;
+}
+
+SlotScope * SlotScope::previous() const
+{
+	return m_previous;
+}
+
+void SlotScope::reconnected()
+{
+	m_reconnected = true;
+}
+
+} // namespace profiling
+
+bool SignalProfiler::available()
+{
+	return true;
+}
+
+void SignalProfiler::start()
+{
+	auto & registry = ::registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	auto & profiles = registry.profiles;
+	profiles.erase(std::remove_if(profiles.begin(), profiles.end(), [] (const std::shared_ptr<ThreadProfile> & profile)
+		{
+			std::lock_guard<std::mutex> lock(profile->mutex);
+			return !profile->alive;
+		}), profiles.end());
+
+	for (auto & profile : profiles)
+	{
+		std::lock_guard<std::mutex> lock(profile->mutex);
+		profile->fires.clear();
+		profile->slots.clear();
+	}
+
+	profiling::s_recording = true;
+}
+
+void SignalProfiler::stop()
+{
+	profiling::s_recording = false;
+}
+
+bool SignalProfiler::recording()
+{
+	return profiling::recording();
+}
+
+void SignalProfiler::setName(const AbstractSignal & signal, const std::string & name)
+{
+	auto & registry = ::registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.names[&signal] = name;
+}
+
+std::vector<SignalRecord> SignalProfiler::signals()
+{
+	std::unordered_map<const AbstractSignal *, SignalRecord> signals;
+	std::unordered_map<SlotKey, SlotRecord, SlotKeyHash> slots;
+
+	{
+		std::lock_guard<std::mutex> lock(registry().mutex);
+		collect(signals, slots);
+	}
+
+	auto result = values(signals);
+
+	std::sort(result.begin(), result.end(), [] (const SignalRecord & record, const SignalRecord & other)
+	{
+		return record.slotNanoseconds != other.slotNanoseconds ? record.slotNanoseconds > other.slotNanoseconds : record.fires > other.fires;
+	});
+
+	return result;
+}
+
+std::vector<SlotRecord> SignalProfiler::slots()
+{
+	std::unordered_map<const AbstractSignal *, SignalRecord> signals;
+	std::unordered_map<SlotKey, SlotRecord, SlotKeyHash> slots;
+
+	{
+		std::lock_guard<std::mutex> lock(registry().mutex);
+		collect(signals, slots);
+	}
+
+	auto result = values(slots);
+
+	std::sort(result.begin(), result.end(), [] (const SlotRecord & record, const SlotRecord & other)
+	{
+		return record.totalNanoseconds != other.totalNanoseconds ? record.totalNanoseconds > other.totalNanoseconds : record.calls > other.calls;
+	});
+
+	return result;
+}
+
+void SignalProfiler::writeReport(std::ostream & stream)
+{
+	const auto milliseconds = [] (std::uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1e6; };
+	const auto microseconds = [] (std::uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1e3; };
+
+	stream << std::fixed << std::setprecision(3);
+
+	stream << std::left << std::setw(40) << "signal" << std::right
+		<< std::setw(12) << "fires" << std::setw(14) << "slots [ms]" << std::endl;
+
+	for (const auto & record : signals())
+	{
+		stream << std::left << std::setw(40) << label(record.signal, record.name) << std::right
+			<< std::setw(12) << record.fires << std::setw(14) << milliseconds(record.slotNanoseconds) << std::endl;
+	}
+
+	stream << std::endl << std::left << std::setw(40) << "slot" << std::right
+		<< std::setw(12) << "calls" << std::setw(14) << "total [ms]" << std::setw(14) << "mean [us]"
+		<< std::setw(14) << "max [us]" << std::setw(12) << "reconnects" << std::endl;
+
+	for (const auto & record : slots())
+	{
+		std::ostringstream slot;
+		slot << label(record.signal, record.name) << " #" << record.connection;
+
+		stream << std::left << std::setw(40) << slot.str() << std::right
+			<< std::setw(12) << record.calls
+			<< std::setw(14) << milliseconds(record.totalNanoseconds)
+			<< std::setw(14) << microseconds(record.totalNanoseconds) / static_cast<double>(record.calls)
+			<< std::setw(14) << microseconds(record.maxNanoseconds)
+			<< std::setw(12) << record.reconnects
+			<< (record.reconnects > 0 ? "  !" : "") << std::endl;
+	}
+}
+
+} // namespace signalzeug
+
+#else
+
+namespace signalzeug
+{
+
+bool SignalProfiler::available()
+{
+	return false;
+}
+
+void SignalProfiler::start()
+{
+}
+
+void SignalProfiler::stop()
+{
+}
+
+bool SignalProfiler::recording()
+{
+	return false;
+}
+
+void SignalProfiler::setName(const AbstractSignal & /*signal*/, const std::string & /*name*/)
+{
+}
+
+std::vector<SignalRecord> SignalProfiler::signals()
+{
+	return std::vector<SignalRecord>();
+}
+
+std::vector<SlotRecord> SignalProfiler::slots()
+{
+	return std::vector<SlotRecord>();
+}
+
+void SignalProfiler::writeReport(std::ostream & /*stream*/)
+{
+}
+
+} // namespace signalzeug
+
+#endif
+
+
+namespace signalzeug
+{
+
+bool SignalProfiler::writeReport(const std::string & fileName)
+{
+	std::ofstream stream(fileName);
+
+	if (!stream)
+		return false;
+
+	writeReport(stream);
+	return static_cast<bool>(stream);
+}
+
+} // namespace signalzeug
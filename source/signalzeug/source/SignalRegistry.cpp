@@ -0,0 +1,98 @@
+
+#include "SignalRegistry.h"
+
+#include <new>
+
+namespace signalzeug
+{
+
+SignalRegistry & SignalRegistry::instance()
+{
+	// never destroyed, as signals and connections may outlive other statics
+	static SignalRegistry * registry = new SignalRegistry;
+	return *registry;
+}
+
+SignalRegistry::SignalRegistry()
+: m_size(1) // index 0 means none
+, m_free(0)
+{
+	for (auto & chunk : m_chunks)
+		chunk = nullptr;
+}
+
+std::uint32_t SignalRegistry::allocate(const AbstractSignal * signal)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::uint32_t index;
+
+	if (m_free != 0)
+	{
+		index = m_free;
+		m_free = entry(index).next;
+	}
+	else
+	{
+		index = m_size;
+
+		const auto chunk = chunkOf(index);
+
+		if (chunk >= s_chunkCount)
+			throw std::bad_alloc();
+
+		if (!m_chunks[chunk].load(std::memory_order_relaxed))
+		{
+			const auto size = chunkBegin(chunk + 1) - chunkBegin(chunk);
+			const auto entries = new Entry[size];
+
+			for (auto i = std::uint32_t(0); i < size; ++i)
+				entries[i].generation = 0;
+
+			m_chunks[chunk].store(entries, std::memory_order_release);
+		}
+
+		++m_size;
+	}
+
+	auto & allocated = entry(index);
+	allocated.signal = signal;
+	allocated.next = 0;
+
+	return index;
+}
+
+void SignalRegistry::release(std::uint32_t index)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto & released = entry(index);
+	++released.generation;
+	released.next = m_free;
+
+	m_free = index;
+}
+
+SignalRegistry::Entry & SignalRegistry::entry(std::uint32_t index) const
+{
+	const auto chunk = chunkOf(index);
+	return m_chunks[chunk].load(std::memory_order_acquire)[index - chunkBegin(chunk)];
+}
+
+int SignalRegistry::chunkOf(std::uint32_t index)
+{
+	auto scaled = static_cast<std::uint64_t>(index) / s_firstChunkSize + 1;
+	auto chunk = 0;
+
+	while (scaled >>= 1)
+		++chunk;
+
+	return chunk;
+}
+
+std::uint32_t SignalRegistry::chunkBegin(int chunk)
+{
+	return static_cast<std::uint32_t>(s_firstChunkSize * ((std::uint64_t(1) << chunk) - 1));
+}
+
+} // namespace signalzeug
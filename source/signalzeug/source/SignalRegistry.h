@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+
+namespace signalzeug
+{
+
+class AbstractSignal;
+
+/** \brief Process-wide table of the existing signals, referred to by index and generation.
+
+	Connections refer to their signal through its entry, so that they can tell whether
+	the signal still exists without sharing any state with it. Releasing an entry
+	increments its generation, which invalidates all connections to the signal at once.
+
+	Entries are stored in chunks that double in size and are never freed or moved, so
+	an entry can be accessed without locking while other entries are allocated. Released
+	entries are reused, linked by next. Index 0 means none.
+*/
+class SignalRegistry
+{
+public:
+	struct Entry
+	{
+		std::atomic<std::uint32_t> generation;
+		const AbstractSignal * signal;
+		std::uint32_t next;
+	};
+
+public:
+	static SignalRegistry & instance();
+
+	/** Returns the index of an unused entry, set to refer to the signal. */
+	std::uint32_t allocate(const AbstractSignal * signal);
+	/** Invalidates the entry and makes it available for reuse. */
+	void release(std::uint32_t index);
+
+	Entry & entry(std::uint32_t index) const;
+
+protected:
+	static const std::uint32_t s_firstChunkSize = 64;
+	static const int s_chunkCount = 26;
+
+	SignalRegistry();
+
+	// chunk c holds the entries from s_firstChunkSize * (2^c - 1) on
+	static int chunkOf(std::uint32_t index);
+	static std::uint32_t chunkBegin(int chunk);
+
+protected:
+	std::mutex m_mutex;
+	std::atomic<Entry *> m_chunks[s_chunkCount];
+	std::uint32_t m_size;
+	std::uint32_t m_free;
+};
+
+} // namespace signalzeug
@@ -0,0 +1,42 @@
+
+#include <signalzeug/Trackable.h>
+
+namespace signalzeug
+{
+
+Tracker::Tracker()
+: m_alive(true)
+{
+}
+
+void Tracker::expire()
+{
+	m_alive.store(false, std::memory_order_release);
+}
+
+Trackable::Trackable()
+: m_tracker(std::make_shared<Tracker>())
+{
+}
+
+Trackable::Trackable(const Trackable & /*trackable*/)
+: m_tracker(std::make_shared<Tracker>())
+{
+}
+
+Trackable::~Trackable()
+{
+	m_tracker->expire();
+}
+
+Trackable & Trackable::operator=(const Trackable & /*trackable*/)
+{
+	return *this;
+}
+
+const std::shared_ptr<Tracker> & Trackable::tracker() const
+{
+	return m_tracker;
+}
+
+} // namespace signalzeug
@@ -0,0 +1,168 @@
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <loggingzeug/AsyncLogHandler.h>
+#include <loggingzeug/FileLogHandler.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+std::vector<std::string> readLines(const std::string & logfile)
+{
+    std::ifstream stream(logfile);
+    std::vector<std::string> lines;
+
+    std::string line;
+    while (std::getline(stream, line))
+        lines.push_back(line);
+
+    return lines;
+}
+
+} // namespace
+
+class AsyncLogHandler_test : public testing::Test
+{
+public:
+    AsyncLogHandler_test()
+    {
+    }
+
+protected:
+    virtual void SetUp() override
+    {
+        std::remove(s_logfile);
+    }
+
+    virtual void TearDown() override
+    {
+        std::remove(s_logfile);
+    }
+
+    static const char * const s_logfile;
+};
+
+const char * const AsyncLogHandler_test::s_logfile = "AsyncLogHandler_test.log";
+
+TEST_F(AsyncLogHandler_test, LinesMatchFileLogHandler)
+{
+    const auto messages = std::vector<LogMessage>{
+        LogMessage(LogMessage::Info, "plain", ""),
+        LogMessage(LogMessage::Debug, "with context", "context"),
+        LogMessage(LogMessage::Warning, "warning", ""),
+        LogMessage(LogMessage::Critical, "critical", "context")
+    };
+
+    {
+        FileLogHandler handler(s_logfile);
+        for (const auto & message : messages)
+            handler.handle(message);
+    }
+
+    const auto expected = readLines(s_logfile);
+    std::remove(s_logfile);
+
+    {
+        AsyncLogHandler handler(s_logfile);
+        for (const auto & message : messages)
+            handler.handle(message);
+    }
+
+    ASSERT_EQ(expected, readLines(s_logfile));
+}
+
+TEST_F(AsyncLogHandler_test, BlockLosesNoMessages)
+{
+    // a tiny ring makes the logging threads wait for the writer most of the time
+    AsyncLogHandler handler(s_logfile, AsyncLogHandler::Block, 4);
+
+    auto threads = std::vector<std::thread>();
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&handler] ()
+        {
+            for (auto i = 0; i < 2000; ++i)
+                handler.handle(LogMessage(LogMessage::Info, std::to_string(i), ""));
+        });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    handler.flush();
+
+    ASSERT_EQ(8000u, readLines(s_logfile).size());
+    ASSERT_EQ(0u, handler.droppedMessages());
+}
+
+TEST_F(AsyncLogHandler_test, FatalIsWrittenBeforeHandleReturns)
+{
+    AsyncLogHandler handler(s_logfile);
+
+    handler.handle(LogMessage(LogMessage::Info, "first", ""));
+    handler.handle(LogMessage(LogMessage::Fatal, "last", ""));
+
+    const auto lines = readLines(s_logfile);
+
+    ASSERT_EQ(2u, lines.size());
+    ASSERT_EQ("#fatal: last", lines.back());
+}
+
+TEST_F(AsyncLogHandler_test, DropCountsDiscardedMessages)
+{
+    auto written = std::size_t(0);
+    auto dropped = std::uint64_t(0);
+
+    {
+        AsyncLogHandler handler(s_logfile, AsyncLogHandler::Drop, 2);
+
+        for (auto i = 0; i < 10000; ++i)
+            handler.handle(LogMessage(LogMessage::Info, "message", ""));
+
+        handler.flush();
+
+        written = readLines(s_logfile).size();
+        dropped = handler.droppedMessages();
+    }
+
+    ASSERT_EQ(10000u, written + dropped);
+    ASSERT_EQ(written, readLines(s_logfile).size());
+}
+
+TEST_F(AsyncLogHandler_test, DropAndReportWritesTheNumberOfDiscardedMessages)
+{
+    auto dropped = std::uint64_t(0);
+
+    {
+        AsyncLogHandler handler(s_logfile, AsyncLogHandler::DropAndReport, 2);
+
+        for (auto i = 0; i < 10000; ++i)
+            handler.handle(LogMessage(LogMessage::Info, "message", ""));
+
+        dropped = handler.droppedMessages();
+    }
+
+    auto reported = std::uint64_t(0);
+    auto written = std::uint64_t(0);
+
+    const auto prefix = std::string("#warning [loggingzeug]: ");
+    for (const auto & line : readLines(s_logfile))
+    {
+        if (line.compare(0, prefix.size(), prefix) == 0)
+            reported += std::stoull(line.substr(prefix.size()));
+        else
+            ++written;
+    }
+
+    ASSERT_EQ(dropped, reported);
+    ASSERT_EQ(10000u, written + dropped);
+}
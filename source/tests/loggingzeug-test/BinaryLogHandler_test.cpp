@@ -0,0 +1,193 @@
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <loggingzeug/BinaryLogHandler.h>
+#include <loggingzeug/BinaryLogReader.h>
+#include <loggingzeug/formatString.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+std::ostream & operator<<(std::ostream & stream, const Point & point)
+{
+    return stream << "(" << point.x << "," << point.y << ")";
+}
+
+std::vector<std::string> readMessages(const std::string & logfile)
+{
+    BinaryLogReader reader(logfile);
+    std::vector<std::string> messages;
+
+    for (const auto & record : reader.records())
+        messages.push_back(record.message.message());
+
+    return messages;
+}
+
+} // namespace
+
+class BinaryLogHandler_test : public testing::Test
+{
+public:
+    BinaryLogHandler_test()
+    {
+    }
+
+protected:
+    virtual void SetUp() override
+    {
+        std::remove(s_logfile);
+    }
+
+    virtual void TearDown() override
+    {
+        std::remove(s_logfile);
+    }
+
+    template <typename... Args>
+    void log(BinaryLogHandler & handler, const char * format, const Args & ... args)
+    {
+        handler.log(LogMessage::Warning, "context", format, args...);
+        m_expected.push_back(formatString(format, args...));
+    }
+
+    static const char * const s_logfile;
+
+    std::vector<std::string> m_expected;
+};
+
+const char * const BinaryLogHandler_test::s_logfile = "BinaryLogHandler_test.binlog";
+
+TEST_F(BinaryLogHandler_test, RecordsAreFormattedAsFormatString)
+{
+    {
+        BinaryLogHandler handler(s_logfile, 1 << 16, 1 << 12);
+        ASSERT_TRUE(handler.isOpen());
+
+        log(handler, "plain");
+        log(handler, "a % b", 42);
+        log(handler, "%5; |%l5; |%05; %x; %#x; %ux;", -3, 7, 12, 255u, 255, static_cast<unsigned long long>(-1));
+        log(handler, "%f.2; %e; %; %;", 3.14159, 2.5e10f, 1.0L / 3, -0.0);
+        log(handler, "%a; %; %; %;", true, false, 'c', static_cast<unsigned char>(200));
+        log(handler, "%?*10; %; %;", "text", std::string("abc"), Point{ 1, 2 });
+        log(handler, "%; %; %; rest % %%", static_cast<short>(-5), -123456789012LL, static_cast<unsigned short>(65535));
+        log(handler, "100%% sure %", 1);
+    }
+
+    BinaryLogReader reader(s_logfile);
+    ASSERT_TRUE(reader.isValid());
+    ASSERT_EQ(m_expected, readMessages(s_logfile));
+
+    ASSERT_EQ("context", reader.records().front().message.context());
+    ASSERT_EQ(LogMessage::Warning, reader.records().front().message.level());
+}
+
+TEST_F(BinaryLogHandler_test, HandledMessagesAreStoredAsText)
+{
+    {
+        BinaryLogHandler handler(s_logfile);
+        handler.handle(LogMessage(LogMessage::Info, "handled %; text", "context"));
+    }
+
+    BinaryLogReader reader(s_logfile);
+    ASSERT_EQ(1u, reader.records().size());
+
+    const auto & message = reader.records().front().message;
+    ASSERT_EQ("handled %; text", message.message());
+    ASSERT_EQ("context", message.context());
+    ASSERT_EQ(LogMessage::Info, message.level());
+}
+
+TEST_F(BinaryLogHandler_test, FullRingOverwritesTheOldestRecords)
+{
+    BinaryLogHandler handler(s_logfile, 4096, 256);
+
+    for (auto i = 0; i < 10000; ++i)
+        log(handler, "message % %", i, std::string(i % 50, 'x'));
+
+    const auto messages = readMessages(s_logfile);
+
+    ASSERT_FALSE(messages.empty());
+    ASSERT_LT(messages.size(), m_expected.size());
+    ASSERT_EQ(std::vector<std::string>(m_expected.end() - messages.size(), m_expected.end()), messages);
+}
+
+TEST_F(BinaryLogHandler_test, SkipRecordsAreReadAcrossTheRingEnd)
+{
+    // records of this size do not divide the ring, so its end is skipped when wrapping;
+    // reading after each count of records also reads right after a wrap, while the skip record is live
+    for (auto count = 1; count < 200; ++count)
+    {
+        m_expected.clear();
+
+        BinaryLogHandler handler(s_logfile, 4096, 256);
+
+        for (auto i = 0; i < count; ++i)
+            log(handler, "message %", std::string(20, 'x'));
+
+        const auto messages = readMessages(s_logfile);
+
+        ASSERT_FALSE(messages.empty());
+        ASSERT_EQ(std::vector<std::string>(m_expected.end() - messages.size(), m_expected.end()), messages);
+    }
+}
+
+TEST_F(BinaryLogHandler_test, MessagesLargerThanAQuarterOfTheRingAreDropped)
+{
+    BinaryLogHandler handler(s_logfile, 4096, 256);
+
+    log(handler, "%", std::string(2000, 'x'));
+    log(handler, "kept");
+
+    ASSERT_EQ(1u, handler.droppedMessages());
+    ASSERT_EQ(std::vector<std::string>({ "kept" }), readMessages(s_logfile));
+}
+
+TEST_F(BinaryLogHandler_test, FormatsAreFormattedWhenTheTableIsFull)
+{
+    BinaryLogHandler handler(s_logfile, 4096, 256);
+
+    for (auto i = 0; i < 40; ++i)
+    {
+        const auto format = "format" + std::to_string(i) + " %";
+        log(handler, format.c_str(), i);
+    }
+
+    ASSERT_EQ(m_expected, readMessages(s_logfile));
+}
+
+TEST_F(BinaryLogHandler_test, ConcurrentLogging)
+{
+    {
+        BinaryLogHandler handler(s_logfile, 1 << 20);
+
+        auto threads = std::vector<std::thread>();
+        for (auto t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&handler, t] ()
+            {
+                for (auto i = 0; i < 2000; ++i)
+                    handler.log(LogMessage::Debug, "thread", "t% i%", t, i);
+            });
+        }
+
+        for (auto & thread : threads)
+            thread.join();
+    }
+
+    ASSERT_EQ(8000u, readMessages(s_logfile).size());
+}
@@ -0,0 +1,42 @@
+#include <gmock/gmock.h>
+
+#include <string>
+
+#include <loggingzeug/ConsoleLogHandler.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+class PrefixedConsoleLogHandler : public ConsoleLogHandler
+{
+public:
+    static std::string prefix(LogMessage::Level level, const std::string & context)
+    {
+        return messagePrefix(LogMessage(level, "", context));
+    }
+};
+
+} // namespace
+
+class ConsoleLogHandler_test : public testing::Test
+{
+public:
+    ConsoleLogHandler_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(ConsoleLogHandler_test, MessagePrefix)
+{
+    ASSERT_EQ("", PrefixedConsoleLogHandler::prefix(LogMessage::Info, ""));
+    ASSERT_EQ("[context]: ", PrefixedConsoleLogHandler::prefix(LogMessage::Debug, "context"));
+    ASSERT_EQ("#warning: ", PrefixedConsoleLogHandler::prefix(LogMessage::Warning, ""));
+    ASSERT_EQ("#critical [context]: ", PrefixedConsoleLogHandler::prefix(LogMessage::Critical, "context"));
+    ASSERT_EQ("#fatal [a much longer context than fits into a small string]: ",
+        PrefixedConsoleLogHandler::prefix(LogMessage::Fatal, "a much longer context than fits into a small string"));
+}
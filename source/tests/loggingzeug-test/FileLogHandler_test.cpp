@@ -0,0 +1,53 @@
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <loggingzeug/FileLogHandler.h>
+
+
+using namespace loggingzeug;
+
+class FileLogHandler_test : public testing::Test
+{
+public:
+    FileLogHandler_test()
+    {
+    }
+
+protected:
+    virtual void SetUp() override
+    {
+        std::remove(s_logfile);
+    }
+
+    virtual void TearDown() override
+    {
+        std::remove(s_logfile);
+    }
+
+    static const char * const s_logfile;
+};
+
+const char * const FileLogHandler_test::s_logfile = "FileLogHandler_test.log";
+
+TEST_F(FileLogHandler_test, LinesArePrefixedWithLevelAndContext)
+{
+    FileLogHandler handler(s_logfile);
+
+    handler.handle(LogMessage(LogMessage::Info, "plain", ""));
+    handler.handle(LogMessage(LogMessage::Debug, "debug", "context"));
+    handler.handle(LogMessage(LogMessage::Warning, "warning", ""));
+    handler.handle(LogMessage(LogMessage::Critical, "critical", "context"));
+
+    std::ifstream stream(s_logfile);
+    std::vector<std::string> lines;
+
+    std::string line;
+    while (std::getline(stream, line))
+        lines.push_back(line);
+
+    ASSERT_EQ(std::vector<std::string>({ "plain", "[context]: debug", "#warning: warning", "#critical [context]: critical" }), lines);
+}
@@ -0,0 +1,132 @@
+#include <gmock/gmock.h>
+
+#include <climits>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <loggingzeug/logging.h>
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/ConsoleLogHandler.h>
+#include <loggingzeug/Format.h>
+#include <loggingzeug/formatString.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+std::ostream & operator<<(std::ostream & stream, const Point & point)
+{
+    return stream << "(" << point.x << "," << point.y << ")";
+}
+
+class CollectingLogHandler : public AbstractLogHandler
+{
+public:
+    virtual void handle(const LogMessage & message) override
+    {
+        messages.push_back(message.message());
+    }
+
+    std::vector<std::string> messages;
+};
+
+} // namespace
+
+// a parsed Format has to produce the same text as formatString parsing on every call
+#define EXPECT_SAME_AS_FORMAT_STRING(...) \
+    EXPECT_EQ(formatString(__VA_ARGS__), formatWith(__VA_ARGS__))
+
+class Format_test : public testing::Test
+{
+public:
+    Format_test()
+    {
+    }
+
+protected:
+    template <typename... Arguments>
+    static std::string formatWith(const char * format, Arguments... arguments)
+    {
+        return Format(format)(arguments...);
+    }
+};
+
+TEST_F(Format_test, PlainText)
+{
+    EXPECT_SAME_AS_FORMAT_STRING("plain");
+    EXPECT_SAME_AS_FORMAT_STRING("100%% of %;", 5);
+    EXPECT_SAME_AS_FORMAT_STRING("%; %% tail %%", 1, 2);
+    EXPECT_SAME_AS_FORMAT_STRING("trailing %", 7);
+    EXPECT_SAME_AS_FORMAT_STRING("%?", 1);
+}
+
+TEST_F(Format_test, ArgumentCountMismatch)
+{
+    EXPECT_SAME_AS_FORMAT_STRING("%; and %; and 100%%", 1);
+    EXPECT_SAME_AS_FORMAT_STRING("%;", 1, 2, 3);
+}
+
+TEST_F(Format_test, Integers)
+{
+    EXPECT_SAME_AS_FORMAT_STRING("%x; %#x; %#X; %u#x; %o; %#o; %#o;", 255, 255, 255, 255, 8, 8, 0);
+    EXPECT_SAME_AS_FORMAT_STRING("%x; %o; %d;", -1, -8, -5);
+    EXPECT_SAME_AS_FORMAT_STRING("%+; %+; %+; %+;", 5, 5u, -5, 0);
+    EXPECT_SAME_AS_FORMAT_STRING("%; %; %;", LLONG_MIN, ULLONG_MAX, static_cast<short>(-3));
+    EXPECT_SAME_AS_FORMAT_STRING("%A; %U;", true, 10);
+}
+
+TEST_F(Format_test, Alignment)
+{
+    EXPECT_SAME_AS_FORMAT_STRING("%l10; %r10; %i10; %i?*10; %i10;", -42, -42, -42, -42, 3.5);
+    EXPECT_SAME_AS_FORMAT_STRING("%i#10x; %l#10x;", 255, 255);
+    EXPECT_SAME_AS_FORMAT_STRING("%10; %l10;|", "abc", std::string("def"));
+    EXPECT_SAME_AS_FORMAT_STRING("%?_8; %8; %08;|", 1, 2, 3);
+}
+
+TEST_F(Format_test, FloatingPoint)
+{
+    EXPECT_SAME_AS_FORMAT_STRING("This is a test: %; pi = %+0E10.5;", 42, 3.141592653589793);
+    EXPECT_SAME_AS_FORMAT_STRING("%; - %X; - %rf?_10.2;", "a string", 255, 2.71828182846);
+    EXPECT_SAME_AS_FORMAT_STRING("%.2; %; %.10; %;", 3.14159, 2.71828, 1.0 / 3, 1.0 / 7);
+    EXPECT_SAME_AS_FORMAT_STRING("%f; %e; %F; %E; %p; %pf.0; %.0;", 1.5, 1.5, 1.5e10, 1.5, 2.0, 2.0, 2.5);
+    EXPECT_SAME_AS_FORMAT_STRING("%; %; %;", INFINITY, -INFINITY, NAN);
+    EXPECT_SAME_AS_FORMAT_STRING("%;", 1.25L);
+    EXPECT_SAME_AS_FORMAT_STRING("%ff10.3;", 2.5f);
+    EXPECT_SAME_AS_FORMAT_STRING("%e.3; %.3;", 12345.678, 12345.678);
+}
+
+TEST_F(Format_test, OtherTypes)
+{
+    EXPECT_SAME_AS_FORMAT_STRING("%; %a; %a10; %+;", true, false, true, true);
+    EXPECT_SAME_AS_FORMAT_STRING("%; %5; %;", 'x', 'y', static_cast<unsigned char>(66));
+    EXPECT_SAME_AS_FORMAT_STRING("%; %10;", Point{ 1, 2 }, Point{ 3, 4 });
+}
+
+TEST_F(Format_test, LogStatementsReuseTheParsedFormat)
+{
+    auto handler = new CollectingLogHandler;
+    setLoggingHandler(handler);
+
+    for (auto i = 0; i < 3; ++i)
+        fInfo(LOGGINGZEUG_FORMAT("frame %; took %f.2; ms"), i, 0.5 * i);
+
+    setVerbosityLevel(LogMessage::Warning);
+    fInfo(LOGGINGZEUG_FORMAT("discarded %;"), 1);
+
+    const auto messages = handler->messages;
+
+    setLoggingHandler(new ConsoleLogHandler);
+    setVerbosityLevel(LogMessage::Info);
+
+    ASSERT_EQ(std::vector<std::string>({ "frame 0 took 0.00 ms", "frame 1 took 0.50 ms", "frame 2 took 1.00 ms" }), messages);
+}
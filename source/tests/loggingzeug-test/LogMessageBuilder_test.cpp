@@ -0,0 +1,148 @@
+#include <gmock/gmock.h>
+
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <loggingzeug/logging.h>
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/ConsoleLogHandler.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+class CollectingLogHandler : public AbstractLogHandler
+{
+public:
+    virtual void handle(const LogMessage & message) override
+    {
+        messages.push_back(message.message());
+    }
+
+    std::vector<std::string> messages;
+};
+
+} // namespace
+
+// the builder has to produce the same text as the std::stringstream it replaced
+#define EXPECT_SAME_AS_STREAM(expression) \
+    do \
+    { \
+        std::ostringstream stream; \
+        stream << expression; \
+        info() << expression; \
+        EXPECT_EQ(stream.str(), m_handler->messages.back()); \
+    } \
+    while (false)
+
+class LogMessageBuilder_test : public testing::Test
+{
+public:
+    LogMessageBuilder_test()
+    : m_handler(nullptr)
+    {
+    }
+
+protected:
+    virtual void SetUp() override
+    {
+        m_handler = new CollectingLogHandler;
+        setLoggingHandler(m_handler);
+    }
+
+    virtual void TearDown() override
+    {
+        setLoggingHandler(new ConsoleLogHandler);
+        setVerbosityLevel(LogMessage::Info);
+    }
+
+    CollectingLogHandler * m_handler;
+};
+
+TEST_F(LogMessageBuilder_test, Integers)
+{
+    EXPECT_SAME_AS_STREAM("text " << 42 << ' ' << -17 << ' ' << INT_MIN << ' ' << INT_MAX << ' ' << 0);
+    EXPECT_SAME_AS_STREAM(LLONG_MIN << " " << LLONG_MAX << " " << ULLONG_MAX << " " << LONG_MIN << " " << 7ul << " " << 3u);
+    EXPECT_SAME_AS_STREAM(static_cast<unsigned char>(65) << 'B' << std::string("str"));
+}
+
+TEST_F(LogMessageBuilder_test, FloatingPoint)
+{
+    EXPECT_SAME_AS_STREAM(3.14159265358979 << " " << 1e100 << " " << 1e-7 << " " << 0.0 << " " << -2.5f << " " << 100000.0 << " " << 1234567.0);
+    EXPECT_SAME_AS_STREAM(std::setprecision(12) << 3.14159265358979 << " " << std::setprecision(2) << 2.71828L << " " << 1e300L);
+    EXPECT_SAME_AS_STREAM(INFINITY << " " << -INFINITY << " " << DBL_MAX << " " << FLT_MIN);
+}
+
+TEST_F(LogMessageBuilder_test, Manipulators)
+{
+    EXPECT_SAME_AS_STREAM(std::setw(8) << 42 << "|" << std::setfill('0') << std::setw(5) << 7 << "|" << std::setw(4) << 'x' << "|" << 5);
+}
+
+TEST_F(LogMessageBuilder_test, Pointers)
+{
+    const auto pointer = reinterpret_cast<void *>(0x1234abcd);
+    const void * null = nullptr;
+
+    EXPECT_SAME_AS_STREAM(pointer << " " << null);
+}
+
+TEST_F(LogMessageBuilder_test, Booleans)
+{
+    info() << true << false;
+
+    ASSERT_EQ("truefalse", m_handler->messages.back());
+}
+
+TEST_F(LogMessageBuilder_test, StringsIgnoreTheFieldWidth)
+{
+    // as with the stringstream builder, which wrote strings unformatted
+    info() << std::setw(6) << "ab" << 1;
+
+    ASSERT_EQ("ab     1", m_handler->messages.back());
+}
+
+TEST_F(LogMessageBuilder_test, Containers)
+{
+    info() << std::vector<int>{ 1, 2, 3 };
+
+    ASSERT_EQ("vector(1, 2, 3)", m_handler->messages.back());
+}
+
+TEST_F(LogMessageBuilder_test, MessagesLongerThanTheInlineBuffer)
+{
+    const auto text = std::string(1000, 'x');
+
+    info() << text << 5 << text;
+
+    ASSERT_EQ(text + "5" + text, m_handler->messages.back());
+}
+
+TEST_F(LogMessageBuilder_test, MovedBuilderLogsOnce)
+{
+    {
+        auto builder = info("context");
+        builder << "moved";
+
+        auto moved = std::move(builder);
+        moved << 1;
+    }
+
+    ASSERT_EQ(std::vector<std::string>({ "moved1" }), m_handler->messages);
+}
+
+TEST_F(LogMessageBuilder_test, DiscardedBuilderLogsNothing)
+{
+    setVerbosityLevel(LogMessage::Warning);
+
+    info() << 5;
+
+    ASSERT_TRUE(m_handler->messages.empty());
+}
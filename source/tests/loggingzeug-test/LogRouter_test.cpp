@@ -0,0 +1,228 @@
+#include <gmock/gmock.h>
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <loggingzeug/logging.h>
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/ConsoleLogHandler.h>
+#include <loggingzeug/LogRouter.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+class CollectingLogHandler : public AbstractLogHandler
+{
+public:
+    virtual void handle(const LogMessage & message) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messages.push_back(message.message());
+    }
+
+    std::vector<std::string> messages() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_messages;
+    }
+
+protected:
+    mutable std::mutex m_mutex;
+    std::vector<std::string> m_messages;
+};
+
+} // namespace
+
+class LogRouter_test : public testing::Test
+{
+public:
+    LogRouter_test()
+    : m_router(nullptr)
+    , m_console(nullptr)
+    , m_file(nullptr)
+    , m_trace(nullptr)
+    {
+    }
+
+protected:
+    virtual void SetUp() override
+    {
+        m_router = new LogRouter;
+
+        m_console = new CollectingLogHandler;
+        m_file = new CollectingLogHandler;
+        m_trace = new CollectingLogHandler;
+
+        m_router->addSink(m_console, LogMessage::Warning);
+        m_router->addSink(m_file);
+        m_router->addSink(m_trace, LogMessage::Debug);
+    }
+
+    virtual void TearDown() override
+    {
+        delete m_router;
+    }
+
+    void send(LogMessage::Level level, const std::string & message, const std::string & context = "")
+    {
+        m_router->handle(LogMessage(level, message, context));
+    }
+
+    LogRouter * m_router;
+
+    CollectingLogHandler * m_console;
+    CollectingLogHandler * m_file;
+    CollectingLogHandler * m_trace;
+};
+
+TEST_F(LogRouter_test, SinksAcceptMessagesUpToTheirLevel)
+{
+    send(LogMessage::Critical, "critical");
+    send(LogMessage::Warning, "warning");
+    send(LogMessage::Debug, "debug");
+    send(LogMessage::Info, "info");
+
+    ASSERT_EQ(std::vector<std::string>({ "critical", "warning" }), m_console->messages());
+    ASSERT_EQ(std::vector<std::string>({ "critical", "warning", "debug", "info" }), m_file->messages());
+    ASSERT_EQ(std::vector<std::string>({ "critical", "warning", "debug" }), m_trace->messages());
+
+    ASSERT_EQ(LogMessage::Info, m_router->maxLevel());
+}
+
+TEST_F(LogRouter_test, IncludedContextsRestrictTheSink)
+{
+    m_router->includeContext(2, "render");
+    m_router->includeContext(2, "physics");
+
+    send(LogMessage::Debug, "render", "render");
+    send(LogMessage::Debug, "physics", "physics");
+    send(LogMessage::Debug, "network", "network");
+    send(LogMessage::Debug, "global");
+
+    ASSERT_EQ(std::vector<std::string>({ "render", "physics" }), m_trace->messages());
+    ASSERT_EQ(4u, m_file->messages().size());
+}
+
+TEST_F(LogRouter_test, ExcludedContextsAreRejected)
+{
+    m_router->excludeContext(1, "noisy");
+
+    send(LogMessage::Critical, "noisy", "noisy");
+    send(LogMessage::Critical, "quiet", "quiet");
+
+    ASSERT_EQ(std::vector<std::string>({ "quiet" }), m_file->messages());
+    ASSERT_EQ(2u, m_console->messages().size());
+}
+
+TEST_F(LogRouter_test, ExclusionWinsOverInclusion)
+{
+    m_router->includeContext(2, "render");
+    m_router->excludeContext(2, "render");
+
+    send(LogMessage::Critical, "render", "render");
+
+    ASSERT_TRUE(m_trace->messages().empty());
+}
+
+TEST_F(LogRouter_test, ReconfigurationInvalidatesCachedDecisions)
+{
+    send(LogMessage::Info, "before", "render");
+
+    m_router->setMaxLevel(2, LogMessage::Info);
+    m_router->excludeContext(1, "render");
+
+    send(LogMessage::Info, "after", "render");
+
+    ASSERT_EQ(std::vector<std::string>({ "after" }), m_trace->messages());
+    ASSERT_EQ(std::vector<std::string>({ "before" }), m_file->messages());
+}
+
+TEST_F(LogRouter_test, ReconfigurationInvalidatesDecisionsCachedByOtherThreads)
+{
+    std::promise<void> cached;
+    std::promise<void> reconfigured;
+
+    auto isCached = cached.get_future();
+    auto isReconfigured = reconfigured.get_future();
+
+    std::thread thread([this, &cached, &isReconfigured] ()
+    {
+        send(LogMessage::Info, "first", "render");
+        cached.set_value();
+
+        isReconfigured.wait();
+        send(LogMessage::Info, "second", "render");
+    });
+
+    isCached.wait();
+    m_router->setMaxLevel(1, LogMessage::Warning);
+    reconfigured.set_value();
+
+    thread.join();
+
+    ASSERT_EQ(std::vector<std::string>({ "first" }), m_file->messages());
+}
+
+TEST_F(LogRouter_test, RoutersAsSinks)
+{
+    auto inner = new LogRouter;
+    auto innerSink = new CollectingLogHandler;
+
+    inner->addSink(innerSink);
+    inner->includeContext(0, "inner");
+    m_router->addSink(inner);
+
+    send(LogMessage::Info, "inner", "inner");
+    send(LogMessage::Info, "outer", "outer");
+
+    ASSERT_EQ(std::vector<std::string>({ "inner" }), innerSink->messages());
+    ASSERT_EQ(std::vector<std::string>({ "inner", "outer" }), m_file->messages());
+}
+
+TEST_F(LogRouter_test, ConcurrentMessages)
+{
+    auto threads = std::vector<std::thread>();
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([this] ()
+        {
+            for (auto i = 0; i < 1000; ++i)
+                send(LogMessage::Warning, std::to_string(i), "context" + std::to_string(i % 7));
+        });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    ASSERT_EQ(4000u, m_file->messages().size());
+    ASSERT_EQ(4000u, m_console->messages().size());
+}
+
+TEST_F(LogRouter_test, RoutesTheLoggingFunctions)
+{
+    m_router->includeContext(2, "render");
+
+    setVerbosityLevel(m_router->maxLevel());
+    setLoggingHandler(m_router);
+
+    info() << "info";
+    warning() << "warning";
+    debug("render") << "render";
+
+    const auto console = m_console->messages();
+    const auto trace = m_trace->messages();
+
+    // the router is deleted by the next handler
+    setLoggingHandler(new ConsoleLogHandler);
+    setVerbosityLevel(LogMessage::Info);
+    m_router = nullptr;
+
+    ASSERT_EQ(std::vector<std::string>({ "warning" }), console);
+    ASSERT_EQ(std::vector<std::string>({ "render" }), trace);
+}
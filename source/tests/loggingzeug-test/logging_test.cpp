@@ -0,0 +1,116 @@
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include <loggingzeug/logging.h>
+#include <loggingzeug/AbstractLogHandler.h>
+#include <loggingzeug/ConsoleLogHandler.h>
+
+
+using namespace loggingzeug;
+
+namespace
+{
+
+class CollectingLogHandler : public AbstractLogHandler
+{
+public:
+    virtual void handle(const LogMessage & message) override
+    {
+        messages.push_back(message.context() + "|" + message.message());
+    }
+
+    std::vector<std::string> messages;
+};
+
+LOGGINGZEUG_CONTEXT(WarningContext, "warning", Warning);
+LOGGINGZEUG_CONTEXT(DebugContext, "debug", Debug);
+
+int evaluations = 0;
+
+int evaluate()
+{
+    return ++evaluations;
+}
+
+} // namespace
+
+class logging_test : public testing::Test
+{
+public:
+    logging_test()
+    : m_handler(nullptr)
+    {
+    }
+
+protected:
+    virtual void SetUp() override
+    {
+        evaluations = 0;
+
+        m_handler = new CollectingLogHandler;
+        setLoggingHandler(m_handler);
+        setVerbosityLevel(LogMessage::Info);
+    }
+
+    virtual void TearDown() override
+    {
+        setLoggingHandler(new ConsoleLogHandler);
+        setVerbosityLevel(LogMessage::Info);
+    }
+
+    CollectingLogHandler * m_handler;
+};
+
+TEST_F(logging_test, StatementsWithinTheContextLevelAreLogged)
+{
+    LOGGINGZEUG_WARNING(WarningContext) << "warning " << evaluate();
+    LOGGINGZEUG_DEBUG(DebugContext) << "debug " << evaluate();
+    LOGGINGZEUG_CRITICAL(GlobalContext) << "critical";
+
+    ASSERT_EQ(std::vector<std::string>({ "warning|warning 1", "debug|debug 2", "|critical" }), m_handler->messages);
+}
+
+TEST_F(logging_test, StatementsAboveTheContextLevelAreNotEvaluated)
+{
+    LOGGINGZEUG_DEBUG(WarningContext) << evaluate();
+    LOGGINGZEUG_INFO(WarningContext) << evaluate();
+    LOGGINGZEUG_INFO(DebugContext) << evaluate();
+
+    ASSERT_EQ(0, evaluations);
+    ASSERT_TRUE(m_handler->messages.empty());
+}
+
+TEST_F(logging_test, StatementsAboveTheVerbosityLevelAreNotEvaluated)
+{
+    setVerbosityLevel(LogMessage::Warning);
+
+    LOGGINGZEUG_DEBUG(DebugContext) << evaluate();
+    LOGGINGZEUG_INFO(GlobalContext) << evaluate();
+    LOGGINGZEUG_WARNING(DebugContext) << evaluate();
+
+    ASSERT_EQ(1, evaluations);
+    ASSERT_EQ(std::vector<std::string>({ "debug|1" }), m_handler->messages);
+}
+
+TEST_F(logging_test, StatementsWithoutHandlerAreNotEvaluated)
+{
+    setLoggingHandler(nullptr);
+
+    LOGGINGZEUG_FATAL(GlobalContext) << evaluate();
+
+    ASSERT_EQ(0, evaluations);
+}
+
+TEST_F(logging_test, FunctionsRespectTheVerbosityLevel)
+{
+    setVerbosityLevel(LogMessage::Debug);
+
+    info() << "info";
+    debug("context") << "debug";
+    fInfo("%;", 5);
+    fDebug("%;", 6);
+
+    ASSERT_EQ(std::vector<std::string>({ "context|debug", "|6" }), m_handler->messages);
+}
@@ -0,0 +1,121 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <signalzeug/ConcurrentSignal.h>
+#include <signalzeug/Trackable.h>
+
+
+using namespace signalzeug;
+
+namespace
+{
+
+class Receiver : public Trackable
+{
+};
+
+} // namespace
+
+class ConcurrentSignal_test : public testing::Test
+{
+public:
+    ConcurrentSignal_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(ConcurrentSignal_test, CallsSlotsInConnectionOrder)
+{
+    ConcurrentSignal<int> signal;
+    std::vector<int> calls;
+
+    for (auto i = 0; i < 5; ++i)
+        signal.connect([&calls, i] (int value) { calls.push_back(i * 10 + value); });
+
+    signal.fire(1);
+
+    ASSERT_EQ(std::vector<int>({ 1, 11, 21, 31, 41 }), calls);
+}
+
+TEST_F(ConcurrentSignal_test, SlotDisconnectsItselfWhileFired)
+{
+    ConcurrentSignal<> signal;
+    auto calls = 0;
+    Connection connection;
+
+    connection = signal.connect([&calls, &connection] ()
+    {
+        ++calls;
+        connection.disconnect();
+    });
+
+    signal.fire();
+    signal.fire();
+
+    ASSERT_EQ(1, calls);
+}
+
+TEST_F(ConcurrentSignal_test, DisconnectsDestroyedReceiver)
+{
+    ConcurrentSignal<> signal;
+    auto calls = 0;
+
+    {
+        Receiver receiver;
+        signal.connect([&calls] () { ++calls; }, receiver);
+
+        signal.fire();
+    }
+
+    signal.fire();
+
+    ASSERT_EQ(1, calls);
+}
+
+TEST_F(ConcurrentSignal_test, ConnectsAndFiresFromSeveralThreads)
+{
+    ConcurrentSignal<int> signal;
+    std::atomic<bool> stop(false);
+    std::atomic<long> calls(0);
+
+    signal.connect([&calls] (int value) { calls += value; });
+
+    std::vector<std::thread> firing;
+    for (auto i = 0; i < 2; ++i)
+        firing.emplace_back([&signal, &stop] () { while (!stop) signal.fire(1); });
+
+    std::vector<std::thread> connecting;
+    for (auto i = 0; i < 2; ++i)
+    {
+        connecting.emplace_back([&signal] ()
+        {
+            for (auto j = 0; j < 1000; ++j)
+            {
+                auto temporary = signal.connect([] (int) {});
+                auto nested = signal.connect([&signal] (int) { signal.connect([] (int) {}).disconnect(); });
+
+                temporary.disconnect();
+                nested.disconnect();
+            }
+        });
+    }
+
+    for (auto & thread : connecting)
+        thread.join();
+
+    stop = true;
+
+    for (auto & thread : firing)
+        thread.join();
+
+    const auto before = calls.load();
+    signal.fire(1);
+
+    ASSERT_EQ(before + 1, calls.load());
+}
@@ -0,0 +1,92 @@
+#include <gmock/gmock.h>
+
+#include <memory>
+
+#include <signalzeug/Connection.h>
+#include <signalzeug/ScopedConnection.h>
+#include <signalzeug/Signal.h>
+
+
+using namespace signalzeug;
+
+class Connection_test : public testing::Test
+{
+public:
+    Connection_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(Connection_test, DisconnectingTwiceIsHarmless)
+{
+    Signal<> signal;
+    auto first = 0;
+    auto second = 0;
+
+    auto connection = signal.connect([&first] () { ++first; });
+    signal.connect([&second] () { ++second; });
+
+    auto copy = connection;
+    connection.disconnect();
+    copy.disconnect();
+
+    signal.fire();
+
+    ASSERT_EQ(0, first);
+    ASSERT_EQ(1, second);
+}
+
+TEST_F(Connection_test, DefaultConnectionDisconnectsNothing)
+{
+    Connection connection;
+    connection.disconnect();
+}
+
+TEST_F(Connection_test, OutlivesItsSignal)
+{
+    Connection connection;
+
+    {
+        Signal<> signal;
+        connection = signal.connect([] () {});
+    }
+
+    connection.disconnect();
+}
+
+TEST_F(Connection_test, DoesNotDisconnectSlotOfLaterSignal)
+{
+    Connection stale;
+
+    {
+        Signal<> signal;
+        stale = signal.connect([] () {});
+    }
+
+    // the later signal may reuse the registry entry and the slot id of the destroyed one
+    std::unique_ptr<Signal<>> signal(new Signal<>);
+    auto calls = 0;
+    signal->connect([&calls] () { ++calls; });
+
+    stale.disconnect();
+    signal->fire();
+
+    ASSERT_EQ(1, calls);
+}
+
+TEST_F(Connection_test, ScopedConnectionDisconnectsOnDestruction)
+{
+    Signal<> signal;
+    auto calls = 0;
+
+    {
+        ScopedConnection scoped = signal.connect([&calls] () { ++calls; });
+        signal.fire();
+    }
+
+    signal.fire();
+
+    ASSERT_EQ(1, calls);
+}
@@ -0,0 +1,123 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <signalzeug/Dispatcher.h>
+#include <signalzeug/Signal.h>
+
+
+using namespace signalzeug;
+
+class Dispatcher_test : public testing::Test
+{
+public:
+    Dispatcher_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(Dispatcher_test, QueuedDeliversEveryFireInOrder)
+{
+    Dispatcher dispatcher;
+    Signal<int> signal;
+    std::vector<int> calls;
+
+    signal.connect([&calls] (int value) { calls.push_back(value); }, dispatcher);
+
+    signal.fire(1);
+    signal.fire(2);
+    signal.fire(3);
+
+    ASSERT_TRUE(calls.empty());
+    ASSERT_TRUE(dispatcher.hasPendingEvents());
+
+    ASSERT_EQ(3u, dispatcher.processEvents());
+    ASSERT_EQ(std::vector<int>({ 1, 2, 3 }), calls);
+}
+
+TEST_F(Dispatcher_test, CoalescedDeliversLatestFireOnce)
+{
+    Dispatcher dispatcher;
+    Signal<int> signal;
+    std::vector<int> calls;
+
+    signal.connect([&calls] (int value) { calls.push_back(value); }, dispatcher, Delivery::Coalesced);
+
+    for (auto i = 0; i < 10; ++i)
+        signal.fire(i);
+
+    dispatcher.processEvents();
+    signal.fire(10);
+    dispatcher.processEvents();
+
+    ASSERT_EQ(std::vector<int>({ 9, 10 }), calls);
+}
+
+TEST_F(Dispatcher_test, EventsPostedWhileProcessingWaitForNextCall)
+{
+    Dispatcher dispatcher;
+    auto calls = 0;
+
+    dispatcher.post([&dispatcher, &calls] ()
+    {
+        ++calls;
+        dispatcher.post([&calls] () { ++calls; });
+    });
+
+    ASSERT_EQ(1u, dispatcher.processEvents());
+    ASSERT_EQ(1, calls);
+
+    ASSERT_EQ(1u, dispatcher.processEvents());
+    ASSERT_EQ(2, calls);
+}
+
+TEST_F(Dispatcher_test, DropsEventsOfDisconnectedConnection)
+{
+    Dispatcher dispatcher;
+    Signal<int> signal;
+    auto calls = 0;
+
+    auto connection = signal.connect([&calls] (int) { ++calls; }, dispatcher);
+
+    signal.fire(1);
+    connection.disconnect();
+
+    dispatcher.processEvents();
+
+    ASSERT_EQ(0, calls);
+}
+
+TEST_F(Dispatcher_test, DeliversOnProcessingThread)
+{
+    Dispatcher dispatcher;
+    Signal<int> signal;
+    std::atomic<int> sum(0);
+    std::thread::id receiver;
+
+    signal.connect([&sum, &receiver] (int value)
+    {
+        sum += value;
+        receiver = std::this_thread::get_id();
+    }, dispatcher);
+
+    std::thread sender([&signal] ()
+    {
+        for (auto i = 1; i <= 100; ++i)
+            signal.fire(i);
+    });
+
+    while (sum < 5050)
+    {
+        dispatcher.waitForEvents();
+        dispatcher.processEvents();
+    }
+
+    sender.join();
+
+    ASSERT_EQ(5050, sum.load());
+    ASSERT_EQ(std::this_thread::get_id(), receiver);
+}
@@ -0,0 +1,65 @@
+#include <gmock/gmock.h>
+
+#include <memory>
+
+#include <signalzeug/EpochReclaimer.h>
+
+
+using namespace signalzeug;
+
+class EpochReclaimer_test : public testing::Test
+{
+public:
+    EpochReclaimer_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(EpochReclaimer_test, DestroysWithoutReadersRightAway)
+{
+    EpochReclaimer reclaimer;
+    auto destroyed = false;
+
+    reclaimer.retire([&destroyed] () { destroyed = true; });
+
+    ASSERT_TRUE(destroyed);
+}
+
+TEST_F(EpochReclaimer_test, DefersDestructionWhileReaderIsActive)
+{
+    EpochReclaimer reclaimer;
+    auto first = false;
+    auto second = false;
+
+    {
+        EpochReclaimer::ReadGuard guard(reclaimer);
+
+        reclaimer.retire([&first] () { first = true; });
+        ASSERT_FALSE(first);
+    }
+
+    reclaimer.retire([&second] () { second = true; });
+
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+}
+
+TEST_F(EpochReclaimer_test, DestroysRemainingDataOnDestruction)
+{
+    auto destroyed = false;
+
+    {
+        EpochReclaimer reclaimer;
+
+        {
+            EpochReclaimer::ReadGuard guard(reclaimer);
+            reclaimer.retire([&destroyed] () { destroyed = true; });
+        }
+
+        ASSERT_FALSE(destroyed);
+    }
+
+    ASSERT_TRUE(destroyed);
+}
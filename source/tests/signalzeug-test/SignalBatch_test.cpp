@@ -0,0 +1,182 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <signalzeug/Dispatcher.h>
+#include <signalzeug/Signal.h>
+#include <signalzeug/SignalBatch.h>
+
+
+using namespace signalzeug;
+
+namespace
+{
+
+struct NonCopyable
+{
+    NonCopyable(int value)
+    : value(value)
+    {
+    }
+
+    NonCopyable(const NonCopyable &) = delete;
+
+    int value;
+};
+
+} // namespace
+
+static_assert(IsBatchable<int, const std::vector<int> &>::value, "copyable arguments are batchable");
+static_assert(!IsBatchable<int &>::value, "non-const references are not batchable");
+static_assert(!IsBatchable<const NonCopyable &>::value, "non-copyable arguments are not batchable");
+
+class SignalBatch_test : public testing::Test
+{
+public:
+    SignalBatch_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(SignalBatch_test, CoalescesFiresPerSignal)
+{
+    Signal<int> first;
+    Signal<int> second;
+    std::vector<int> calls;
+
+    first.connect([&calls, &second] (int value)
+    {
+        calls.push_back(value);
+        second.fire(value * 10);
+    });
+    second.connect([&calls] (int value) { calls.push_back(value); });
+
+    {
+        SignalBatch batch;
+
+        for (auto i = 0; i < 100; ++i)
+            first.fire(i);
+
+        {
+            SignalBatch inner;
+            second.fire(7);
+        }
+
+        ASSERT_TRUE(calls.empty());
+    }
+
+    // fires caused by delivered slots are not deferred
+    ASSERT_EQ(std::vector<int>({ 99, 990, 7 }), calls);
+}
+
+TEST_F(SignalBatch_test, FlushDeliversRecordedFires)
+{
+    Signal<int> signal;
+    std::vector<int> calls;
+
+    signal.connect([&calls] (int value) { calls.push_back(value); });
+
+    SignalBatch batch;
+
+    signal.fire(1);
+    batch.flush();
+    ASSERT_EQ(std::vector<int>({ 1 }), calls);
+
+    signal.fire(2);
+    ASSERT_EQ(std::vector<int>({ 1 }), calls);
+}
+
+TEST_F(SignalBatch_test, DropsFiresOfDestroyedSignal)
+{
+    auto calls = 0;
+
+    {
+        SignalBatch batch;
+
+        std::unique_ptr<Signal<>> signal(new Signal<>);
+        signal->connect([&calls] () { ++calls; });
+        signal->fire();
+    }
+
+    ASSERT_EQ(0, calls);
+}
+
+TEST_F(SignalBatch_test, FiresNonConstReferenceArgumentsRightAway)
+{
+    Signal<int &> signal;
+    signal.connect([] (int & result) { result = 42; });
+
+    SignalBatch batch;
+
+    auto result = 0;
+    signal.fire(result);
+
+    ASSERT_EQ(42, result);
+}
+
+TEST_F(SignalBatch_test, FiresNonCopyableArgumentsRightAway)
+{
+    Signal<const NonCopyable &> signal;
+    auto received = 0;
+    signal.connect([&received] (const NonCopyable & argument) { received = argument.value; });
+
+    SignalBatch batch;
+    signal.fire(NonCopyable(3));
+
+    ASSERT_EQ(3, received);
+}
+
+TEST_F(SignalBatch_test, DebouncedCallsOnceCallsStop)
+{
+    Dispatcher dispatcher;
+    auto calls = 0;
+    auto last = -1;
+
+    auto debounced = dispatcher.debounced(std::function<void(int)>([&calls, &last] (int value)
+    {
+        ++calls;
+        last = value;
+    }), std::chrono::milliseconds(30));
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        debounced(i);
+        dispatcher.processEvents();
+    }
+
+    ASSERT_EQ(0, calls);
+
+    while (dispatcher.remainingTime() != Dispatcher::Clock::duration::max())
+    {
+        dispatcher.waitForEvents();
+        dispatcher.processEvents();
+    }
+
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(4, last);
+}
+
+TEST_F(SignalBatch_test, ThrottledLimitsCallRate)
+{
+    Dispatcher dispatcher;
+    auto calls = 0;
+
+    auto throttled = dispatcher.throttled(std::function<void(int)>([&calls] (int) { ++calls; }), std::chrono::milliseconds(50));
+
+    const auto start = Dispatcher::Clock::now();
+    while (Dispatcher::Clock::now() - start < std::chrono::milliseconds(120))
+    {
+        throttled(0);
+        dispatcher.processEvents();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // at most one call per interval, the first one right away
+    ASSERT_GE(calls, 1);
+    ASSERT_LE(calls, 3);
+}
@@ -0,0 +1,62 @@
+#include <gmock/gmock.h>
+
+#include <signalzeug/Signal.h>
+#include <signalzeug/SignalProfiler.h>
+
+
+using namespace signalzeug;
+
+class SignalProfiler_test : public testing::Test
+{
+public:
+    SignalProfiler_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(SignalProfiler_test, CountsFiresAndSlotCallsWhileRecording)
+{
+    Signal<int> signal;
+    Connection connection;
+
+    signal.connect([] (int) {});
+    connection = signal.connect([&signal, &connection] (int)
+    {
+        connection.disconnect();
+        signal.connect([] (int) {});
+    });
+
+    SignalProfiler::setName(signal, "signal");
+
+    signal.fire(0);
+
+    SignalProfiler::start();
+    signal.fire(1);
+    signal.fire(2);
+    SignalProfiler::stop();
+
+    signal.fire(3);
+
+    const auto signals = SignalProfiler::signals();
+    const auto slots = SignalProfiler::slots();
+
+    if (!SignalProfiler::available())
+    {
+        ASSERT_TRUE(signals.empty());
+        ASSERT_TRUE(slots.empty());
+        return;
+    }
+
+    ASSERT_EQ(1u, signals.size());
+    ASSERT_EQ("signal", signals.front().name);
+    ASSERT_EQ(2u, signals.front().fires);
+
+    auto calls = std::uint64_t(0);
+    for (const auto & slot : slots)
+        calls += slot.calls;
+
+    // the first slot and the one connected by the unrecorded fire, twice each
+    ASSERT_EQ(4u, calls);
+}
@@ -0,0 +1,191 @@
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+#include <signalzeug/Dispatcher.h>
+#include <signalzeug/Signal.h>
+#include <signalzeug/Trackable.h>
+
+
+using namespace signalzeug;
+
+namespace
+{
+
+class Receiver : public Trackable
+{
+};
+
+} // namespace
+
+class Signal_test : public testing::Test
+{
+public:
+    Signal_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(Signal_test, CallsSlotsInConnectionOrder)
+{
+    Signal<int> signal;
+    std::vector<int> calls;
+
+    for (auto i = 0; i < 5; ++i)
+        signal.connect([&calls, i] (int value) { calls.push_back(i * 10 + value); });
+
+    signal.fire(1);
+
+    ASSERT_EQ(std::vector<int>({ 1, 11, 21, 31, 41 }), calls);
+}
+
+TEST_F(Signal_test, SlotsConnectedWhileFiringAreCalledFromNextFire)
+{
+    Signal<> signal;
+    auto calls = 0;
+
+    signal.connect([&signal, &calls] ()
+    {
+        signal.connect([&calls] () { ++calls; });
+    });
+
+    signal.fire();
+    ASSERT_EQ(0, calls);
+
+    signal.fire();
+    ASSERT_EQ(1, calls);
+}
+
+TEST_F(Signal_test, DisconnectsWhileFiring)
+{
+    Signal<> signal;
+    std::vector<int> calls;
+    Connection second;
+
+    signal.connect([&calls, &second] ()
+    {
+        calls.push_back(1);
+        second.disconnect();
+    });
+    second = signal.connect([&calls] () { calls.push_back(2); });
+    signal.connect([&calls] () { calls.push_back(3); });
+
+    signal.fire();
+    signal.fire();
+
+    ASSERT_EQ(std::vector<int>({ 1, 3, 1, 3 }), calls);
+}
+
+TEST_F(Signal_test, ReleasesSlotDisconnectedWhileFiring)
+{
+    Signal<> signal;
+    const auto captured = std::make_shared<int>(0);
+    Connection connection;
+
+    signal.connect([&connection] () { connection.disconnect(); });
+    connection = signal.connect([captured] () {});
+    signal.connect([] () {});
+    signal.connect([] () {});
+
+    signal.fire();
+
+    // the tombstone is not removed yet, but must not keep its callback alive
+    ASSERT_EQ(1, captured.use_count());
+}
+
+TEST_F(Signal_test, DropsQueuedEventsOfSlotDisconnectedWhileFiring)
+{
+    Dispatcher dispatcher;
+    Signal<int> signal;
+    std::vector<int> delivered;
+    Connection queued;
+
+    signal.connect([&queued] (int value)
+    {
+        if (value == 2)
+            queued.disconnect();
+    });
+    queued = signal.connect([&delivered] (int value) { delivered.push_back(value); }, dispatcher);
+    signal.connect([] (int) {});
+    signal.connect([] (int) {});
+
+    signal.fire(1);
+    signal.fire(2);
+
+    dispatcher.processEvents();
+
+    ASSERT_TRUE(delivered.empty());
+}
+
+TEST_F(Signal_test, ReleasesSlotOfDestroyedReceiver)
+{
+    Signal<> signal;
+    const auto captured = std::make_shared<int>(0);
+    auto calls = 0;
+
+    {
+        Receiver receiver;
+        signal.connect([captured, &calls] () { ++calls; }, receiver);
+        signal.connect([] () {});
+        signal.connect([] () {});
+        signal.connect([] () {});
+
+        signal.fire();
+    }
+
+    signal.fire();
+
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(1, captured.use_count());
+}
+
+TEST_F(Signal_test, CopyStartsWithoutSlots)
+{
+    Signal<> signal;
+    auto originalCalls = 0;
+    auto copyCalls = 0;
+
+    signal.connect([&originalCalls] () { ++originalCalls; });
+
+    auto copy = signal;
+    auto connection = copy.connect([&copyCalls] () { ++copyCalls; });
+
+    copy.fire();
+    ASSERT_EQ(0, originalCalls);
+    ASSERT_EQ(1, copyCalls);
+
+    connection.disconnect();
+    copy.fire();
+    signal.fire();
+
+    ASSERT_EQ(1, originalCalls);
+    ASSERT_EQ(1, copyCalls);
+}
+
+TEST_F(Signal_test, AssignmentKeepsOwnSlots)
+{
+    Signal<> signal;
+    Signal<> other;
+    auto calls = 0;
+    auto otherCalls = 0;
+
+    auto connection = signal.connect([&calls] () { ++calls; });
+    other.connect([&otherCalls] () { ++otherCalls; });
+    other.block();
+
+    signal = other;
+    signal.fire();
+    ASSERT_EQ(0, calls);
+
+    signal.unblock();
+    signal.fire();
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(0, otherCalls);
+
+    connection.disconnect();
+    signal.fire();
+    ASSERT_EQ(1, calls);
+}
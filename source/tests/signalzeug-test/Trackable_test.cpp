@@ -0,0 +1,83 @@
+#include <gmock/gmock.h>
+
+#include <memory>
+
+#include <signalzeug/Signal.h>
+#include <signalzeug/Trackable.h>
+
+
+using namespace signalzeug;
+
+namespace
+{
+
+class Receiver : public Trackable
+{
+public:
+    Receiver()
+    : calls(0)
+    {
+    }
+
+    void receive(int value)
+    {
+        calls += value;
+    }
+
+    int calls;
+};
+
+} // namespace
+
+class Trackable_test : public testing::Test
+{
+public:
+    Trackable_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(Trackable_test, MethodSlotIsDisconnectedWithReceiver)
+{
+    Signal<int> signal;
+    std::unique_ptr<Receiver> receiver(new Receiver);
+
+    signal.connect(receiver.get(), &Receiver::receive);
+    signal.fire(2);
+
+    ASSERT_EQ(2, receiver->calls);
+
+    receiver.reset();
+    signal.fire(3);
+}
+
+TEST_F(Trackable_test, CopyIsTrackedSeparately)
+{
+    Signal<int> signal;
+    std::unique_ptr<Receiver> original(new Receiver);
+    Receiver copy(*original);
+
+    signal.connect(&copy, &Receiver::receive);
+    original.reset();
+
+    signal.fire(1);
+
+    ASSERT_EQ(1, copy.calls);
+}
+
+TEST_F(Trackable_test, ReceiverDestroyedBySlotIsSkipped)
+{
+    Signal<> signal;
+    std::unique_ptr<Receiver> receiver(new Receiver);
+    auto calls = 0;
+
+    signal.connect([&receiver] () { receiver.reset(); });
+    signal.connect([&calls] () { ++calls; }, *receiver);
+
+    signal.fire();
+    signal.fire();
+
+    ASSERT_EQ(0, calls);
+}
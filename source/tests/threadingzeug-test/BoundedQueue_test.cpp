@@ -0,0 +1,111 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <threadingzeug/BoundedQueue.h>
+
+
+using namespace threadingzeug;
+
+class BoundedQueue_test : public testing::Test
+{
+public:
+    BoundedQueue_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(BoundedQueue_test, FifoWithinCapacity)
+{
+    BoundedQueue<int> queue(5);
+    ASSERT_EQ(8u, queue.capacity());
+
+    for (auto i = 0; i < 8; ++i)
+        ASSERT_TRUE(queue.tryPush(i));
+
+    ASSERT_FALSE(queue.tryPush(8));
+
+    auto value = -1;
+    for (auto i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue.tryPop(value));
+        ASSERT_EQ(i, value);
+    }
+
+    ASSERT_FALSE(queue.tryPop(value));
+}
+
+TEST_F(BoundedQueue_test, ConcurrentProducersAndConsumers)
+{
+    const auto producers = 3, consumers = 3, count = 20000;
+
+    BoundedQueue<int> queue(64);
+    std::atomic<int> consumed(0);
+    auto received = std::vector<std::vector<int>>(consumers);
+    std::vector<std::thread> threads;
+
+    for (auto p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, p, count] ()
+            {
+                for (auto i = 0; i < count; ++i)
+                {
+                    while (!queue.tryPush(p * count + i))
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    for (auto c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&queue, &consumed, &received, c, producers, count] ()
+            {
+                auto value = 0;
+                while (consumed < producers * count)
+                {
+                    if (!queue.tryPop(value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    received[c].push_back(value);
+                    ++consumed;
+                }
+            });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    std::vector<int> all;
+    for (const auto & values : received)
+    {
+        // values of one producer arrive in the order they were pushed
+        for (auto p = 0; p < producers; ++p)
+        {
+            auto last = -1;
+            for (auto value : values)
+            {
+                if (value / count != p)
+                    continue;
+
+                ASSERT_LT(last, value);
+                last = value;
+            }
+        }
+
+        all.insert(all.end(), values.begin(), values.end());
+    }
+
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(static_cast<std::size_t>(producers * count), all.size());
+
+    for (auto i = 0; i < producers * count; ++i)
+        ASSERT_EQ(i, all[i]);
+}
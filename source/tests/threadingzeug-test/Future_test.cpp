@@ -0,0 +1,95 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <threadingzeug/Future.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class Future_test : public testing::Test
+{
+public:
+    Future_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(Future_test, SpawnAndGet)
+{
+    auto future = spawn([] () { return 6 * 7; });
+
+    ASSERT_TRUE(future.valid());
+    ASSERT_EQ(42, future.get());
+    ASSERT_TRUE(future.ready());
+}
+
+TEST_F(Future_test, ContinuationChain)
+{
+    auto future = spawn([] () { return 21; })
+        .then([] (int value) { return value * 2; })
+        .then([] (int value) { return std::to_string(value); });
+
+    ASSERT_EQ("42", future.get());
+}
+
+TEST_F(Future_test, VoidFutures)
+{
+    std::atomic<int> steps(0);
+
+    auto future = spawn([&steps] () { ++steps; })
+        .then([&steps] () { ++steps; return steps.load(); });
+
+    ASSERT_EQ(2, future.get());
+}
+
+TEST_F(Future_test, ExceptionPropagation)
+{
+    auto called = false;
+
+    auto future = spawn([] () -> int { throw std::runtime_error("failed"); })
+        .then([&called] (int value) { called = true; return value; });
+
+    ASSERT_THROW(future.get(), std::runtime_error);
+    ASSERT_FALSE(called);
+}
+
+TEST_F(Future_test, WhenAllAndWhenAny)
+{
+    auto futures = std::vector<Future<int>>();
+    for (auto i = 0; i < 16; ++i)
+        futures.push_back(spawn([i] () { return i; }));
+
+    auto first = when_any(futures).get();
+    ASSERT_LT(first, futures.size());
+
+    when_all(futures).get();
+
+    for (auto i = 0; i < 16; ++i)
+        ASSERT_EQ(i, futures[i].get());
+}
+
+TEST_F(Future_test, WaitingWorkerHelps)
+{
+    ThreadPool::configure(1);
+
+    // the single worker waits for tasks that are queued behind it
+    auto outer = spawn([] ()
+    {
+        auto sum = 0;
+        for (auto i = 0; i < 8; ++i)
+            sum += spawn([i] () { return i; }).get();
+
+        return sum;
+    });
+
+    ASSERT_EQ(28, outer.get());
+
+    ThreadPool::configure(0);
+}
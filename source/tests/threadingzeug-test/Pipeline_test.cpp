@@ -0,0 +1,143 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <threadingzeug/Pipeline.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class Pipeline_test : public testing::Test
+{
+public:
+    Pipeline_test()
+    {
+        ThreadPool::configure(7);
+    }
+
+    ~Pipeline_test()
+    {
+        ThreadPool::configure(0);
+    }
+
+protected:
+};
+
+TEST_F(Pipeline_test, KeepsSourceOrder)
+{
+    const auto count = 5000;
+    auto next = 0;
+    std::vector<std::string> output;
+
+    auto pipeline = Pipeline::source<int>([&next, count] (int & value)
+        {
+            value = next++;
+            return value < count;
+        }, 16)
+        .stage(0, [] (int && value)
+        {
+            // uneven work lets later items overtake earlier ones
+            if (value % 7 == 0)
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+            return value * 2;
+        })
+        .stage(1, [] (int && value) { return std::to_string(value); })
+        .sink([&output] (std::string && value) { output.push_back(value); });
+
+    pipeline.run();
+
+    ASSERT_EQ(static_cast<std::size_t>(count), output.size());
+
+    for (auto i = 0; i < count; ++i)
+        ASSERT_EQ(std::to_string(i * 2), output[i]);
+}
+
+TEST_F(Pipeline_test, LimitsItemsInFlight)
+{
+    const auto capacity = 8;
+    auto produced = 0;
+    std::atomic<int> consumed(0), maximum(0);
+    std::atomic<int> concurrent(0), maximumConcurrent(0);
+
+    auto pipeline = Pipeline::source<int>([&] (int & value)
+        {
+            value = produced++;
+            maximum = std::max(maximum.load(), produced - consumed.load());
+            return value < 1000;
+        }, capacity)
+        .stage(2, [&] (int && value)
+        {
+            const auto current = ++concurrent;
+            maximumConcurrent = std::max(maximumConcurrent.load(), current);
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            --concurrent;
+
+            return value;
+        })
+        .sink([&consumed] (int &&) { ++consumed; });
+
+    pipeline.run();
+
+    ASSERT_EQ(1000, consumed.load());
+    // the source call that finds the source exhausted may exceed the capacity by one
+    ASSERT_LE(maximum.load(), capacity + 1);
+    ASSERT_LE(maximumConcurrent.load(), 2);
+}
+
+TEST_F(Pipeline_test, RethrowsStageException)
+{
+    auto next = 0;
+
+    auto pipeline = Pipeline::source<int>([&next] (int & value)
+        {
+            value = next++;
+            return true;
+        })
+        .stage(0, [] (int && value) -> int
+        {
+            if (value == 100)
+                throw std::runtime_error("failed");
+
+            return value;
+        })
+        .sink([] (int &&) { });
+
+    ASSERT_THROW(pipeline.run(), std::runtime_error);
+}
+
+TEST_F(Pipeline_test, IdleThreadsSleepWhileSourceWaits)
+{
+    auto next = 0;
+    auto sum = 0;
+
+    auto pipeline = Pipeline::source<int>([&next] (int & value)
+        {
+            // e.g., waiting for input
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+            value = next++;
+            return value < 10;
+        })
+        .stage(0, [] (int && value) { return value * 2; })
+        .sink([&sum] (int && value) { sum += value; });
+
+    const auto cpuStart = std::clock();
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    pipeline.run();
+
+    const auto cpu = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    const auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    ASSERT_EQ(90, sum);
+    // spinning threads would keep at least one core busy all the time
+    ASSERT_LT(cpu, wall / 2);
+}
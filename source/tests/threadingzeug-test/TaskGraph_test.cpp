@@ -0,0 +1,73 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <threadingzeug/TaskGraph.h>
+
+
+using namespace threadingzeug;
+
+class TaskGraph_test : public testing::Test
+{
+public:
+    TaskGraph_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(TaskGraph_test, DependenciesFinishFirst)
+{
+    std::mutex mutex;
+    std::vector<int> order;
+
+    const auto record = [&mutex, &order] (int node)
+    {
+        return [&mutex, &order, node] ()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(node);
+        };
+    };
+
+    TaskGraph graph;
+
+    auto a = graph.add(record(0));
+    auto b = graph.add(record(1), { a });
+    auto c = graph.add(record(2), { a });
+    graph.add(record(3), { b, c });
+
+    for (auto run = 0; run < 10; ++run)
+    {
+        order.clear();
+        graph.run();
+
+        ASSERT_EQ(4u, order.size());
+        ASSERT_EQ(0, order.front());
+        ASSERT_EQ(3, order.back());
+    }
+}
+
+TEST_F(TaskGraph_test, ExceptionSkipsRemainingTasks)
+{
+    std::atomic<bool> executed(false);
+
+    TaskGraph graph;
+
+    auto failing = graph.add([] () { throw std::runtime_error("failed"); });
+    graph.add([&executed] () { executed = true; }, { failing });
+
+    ASSERT_THROW(graph.run(), std::runtime_error);
+    ASSERT_FALSE(executed);
+}
+
+TEST_F(TaskGraph_test, EmptyGraph)
+{
+    TaskGraph graph;
+
+    ASSERT_TRUE(graph.launch().ready());
+}
@@ -0,0 +1,159 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <threadingzeug/ThreadPool.h>
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/topology.h>
+
+
+using namespace threadingzeug;
+
+class ThreadPool_test : public testing::Test
+{
+public:
+    ThreadPool_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(ThreadPool_test, ExecuteRunsEveryJobOnce)
+{
+    ThreadPool pool(3);
+    auto counts = std::vector<std::atomic<int>>(100);
+
+    for (auto & count : counts)
+        count = 0;
+
+    pool.execute(100, [&counts] (unsigned job)
+        {
+            ++counts[job];
+        });
+
+    for (auto & count : counts)
+        ASSERT_EQ(1, count);
+}
+
+TEST_F(ThreadPool_test, SubmittedTasksRun)
+{
+    std::atomic<int> executed(0);
+
+    {
+        ThreadPool pool(2);
+
+        for (auto i = 0; i < 50; ++i)
+            pool.submit([&executed] () { ++executed; });
+    }
+
+    ASSERT_EQ(50, executed);
+}
+
+TEST_F(ThreadPool_test, BlockedWorkerSleeps)
+{
+    ThreadPool pool(2);
+
+    std::atomic<bool> started(false);
+    std::promise<void> finished;
+
+    const auto cpuStart = std::clock();
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    // the worker running this task waits in execute() while the other worker sleeps in job 1
+    pool.submit([&pool, &started, &finished] ()
+    {
+        pool.execute(2, [&started] (unsigned job)
+            {
+                if (job == 1)
+                {
+                    started = true;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+                    return;
+                }
+
+                while (!started)
+                    std::this_thread::yield();
+            });
+
+        finished.set_value();
+    });
+
+    finished.get_future().wait();
+
+    const auto cpu = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    const auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    // waking up to poll for tasks would keep the waiting worker busy
+    ASSERT_LT(cpu, wall / 100);
+}
+
+TEST_F(ThreadPool_test, ParallelForReusesWorkers)
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        parallel_for(0, 64, [&mutex, &threads] (int)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            });
+    }
+
+    ASSERT_LE(threads.size(), ThreadPool::instance().numberOfThreads() + 1);
+}
+
+TEST_F(ThreadPool_test, ExecutePinnedRunsJobsOnTheirWorkers)
+{
+    ThreadPool pool(4);
+    auto workers = std::vector<int>(pool.numberOfThreads(), -2);
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        pool.executePinned([&pool, &workers] (unsigned job)
+            {
+                workers[job] = pool.currentWorker();
+            });
+
+        for (auto job = 0u; job < workers.size(); ++job)
+            ASSERT_EQ(static_cast<int>(job), workers[job]);
+    }
+}
+
+TEST_F(ThreadPool_test, PlacementUsesNumaNodes)
+{
+    const auto nodes = numaNodes();
+    ASSERT_FALSE(nodes.empty());
+
+    for (auto placement : { Placement::Compact, Placement::Spread })
+    {
+        const auto affinity = ThreadPool::affinityFor(6, placement);
+        ASSERT_EQ(6u, affinity.size());
+
+        // workers of one node have consecutive indices
+        std::set<int> finished;
+        auto node = numaNodeOf(affinity[0]);
+
+        for (auto cpu : affinity)
+        {
+            ASSERT_NE(-1, numaNodeOf(cpu));
+
+            if (numaNodeOf(cpu) == node)
+                continue;
+
+            finished.insert(node);
+            node = numaNodeOf(cpu);
+            ASSERT_EQ(0u, finished.count(node));
+        }
+    }
+
+    ASSERT_TRUE(ThreadPool::affinityFor(6, Placement::Unpinned).empty());
+}
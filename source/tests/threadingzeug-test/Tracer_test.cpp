@@ -0,0 +1,92 @@
+#include <gmock/gmock.h>
+
+#include <sstream>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
+#include <threadingzeug/Tracer.h>
+
+
+using namespace threadingzeug;
+
+class Tracer_test : public testing::Test
+{
+public:
+    Tracer_test()
+    {
+        ThreadPool::configure(3);
+    }
+
+    ~Tracer_test()
+    {
+        Tracer::stop();
+        ThreadPool::configure(0);
+    }
+
+protected:
+};
+
+TEST_F(Tracer_test, RecordsLoopsAndChunks)
+{
+    Tracer::start();
+    parallel_for(Range<int>(0, 1 << 16), 1024, [] (int, int) { }, SchedulingPolicy::Dynamic);
+    Tracer::stop();
+
+    if (!Tracer::available())
+    {
+        ASSERT_TRUE(Tracer::counters().empty());
+        ASSERT_TRUE(Tracer::loops().empty());
+        return;
+    }
+
+    const auto loops = Tracer::loops();
+    ASSERT_EQ(1u, loops.size());
+    ASSERT_EQ(1 << 16, loops[0].size);
+    ASSERT_EQ(1024, loops[0].grain);
+    ASSERT_EQ(SchedulingPolicy::Dynamic, loops[0].policy);
+
+    auto chunks = std::uint64_t(0), indices = std::uint64_t(0);
+    for (const auto & counters : Tracer::counters())
+    {
+        chunks += counters.chunks;
+        indices += counters.chunkIndices;
+
+        if (counters.chunks > 0)
+        {
+            ASSERT_EQ(1024u, counters.minChunkSize);
+            ASSERT_EQ(1024u, counters.maxChunkSize);
+        }
+    }
+
+    ASSERT_EQ(64u, chunks);
+    ASSERT_EQ(std::uint64_t(1) << 16, indices);
+}
+
+TEST_F(Tracer_test, StopsRecording)
+{
+    Tracer::start();
+    Tracer::stop();
+
+    parallel_for(Range<int>(0, 1 << 16), 1024, [] (int, int) { });
+
+    ASSERT_FALSE(Tracer::recording());
+    ASSERT_TRUE(Tracer::loops().empty());
+}
+
+TEST_F(Tracer_test, WritesChromeTrace)
+{
+    Tracer::start();
+    parallel_for(Range<int>(0, 1 << 16), 1024, [] (int, int) { });
+    Tracer::stop();
+
+    std::stringstream trace;
+    Tracer::writeChromeTrace(trace);
+
+    ASSERT_EQ(0u, trace.str().find("{\"traceEvents\":["));
+
+    if (Tracer::available())
+    {
+        ASSERT_NE(std::string::npos, trace.str().find("\"name\":\"parallel_for\""));
+        ASSERT_NE(std::string::npos, trace.str().find("\"name\":\"chunk\""));
+    }
+}
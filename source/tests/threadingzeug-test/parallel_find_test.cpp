@@ -0,0 +1,63 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <threadingzeug/parallelfind.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class parallel_find_test : public testing::Test
+{
+public:
+    parallel_find_test()
+    {
+        ThreadPool::configure(7);
+    }
+
+    ~parallel_find_test()
+    {
+        ThreadPool::configure(0);
+    }
+
+protected:
+};
+
+TEST_F(parallel_find_test, FindsFirstMatch)
+{
+    auto values = std::vector<int>(1 << 20, 0);
+    values[700000] = 1;
+    values[300001] = 1;
+    values[900000] = 1;
+
+    const auto isOne = [] (int value) { return value == 1; };
+
+    ASSERT_EQ(std::find_if(values.begin(), values.end(), isOne) - values.begin(), parallel_find_if(values, isOne) - values.begin());
+}
+
+TEST_F(parallel_find_test, ReturnsEndWithoutMatch)
+{
+    const auto values = std::vector<int>(100000, 0);
+
+    ASSERT_TRUE(parallel_find_if(values, [] (int value) { return value != 0; }) == values.end());
+    ASSERT_EQ(50, parallel_find_if(Range<int>(10, 50), [] (int) { return false; }));
+    ASSERT_EQ(5, parallel_find_if(Range<int>(5, 5), [] (int) { return true; }));
+}
+
+TEST_F(parallel_find_test, StopsEarly)
+{
+    const auto size = std::int64_t(1) << 26;
+    std::atomic<std::int64_t> evaluated(0);
+
+    const auto index = parallel_find_if(Range<std::int64_t>(0, size), [&evaluated] (std::int64_t i)
+    {
+        ++evaluated;
+        return i >= 1000;
+    });
+
+    ASSERT_EQ(1000, index);
+    ASSERT_LT(evaluated.load(), size / 4);
+}
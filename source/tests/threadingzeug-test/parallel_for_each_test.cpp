@@ -0,0 +1,108 @@
+#include <gmock/gmock.h>
+
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include <threadingzeug/parallelforeach.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class parallel_for_each_test : public testing::Test
+{
+public:
+    parallel_for_each_test()
+    {
+        ThreadPool::configure(7);
+    }
+
+    ~parallel_for_each_test()
+    {
+        ThreadPool::configure(0);
+    }
+
+protected:
+};
+
+TEST_F(parallel_for_each_test, BlocksCoverVectorOnce)
+{
+    auto values = std::vector<float>(100003, 1.0f);
+
+    std::mutex mutex;
+    std::vector<Span<float>> blocks;
+
+    parallel_for_each(values, [&mutex, &blocks] (Span<float> block)
+        {
+            for (auto & value : block)
+                value *= 2.0f;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            blocks.push_back(block);
+        }, 1000);
+
+    for (auto value : values)
+        ASSERT_EQ(2.0f, value);
+
+    ASSERT_GT(blocks.size(), 1u);
+
+    for (const auto & block : blocks)
+    {
+        // blocks start at aligned offsets and, but for the last one, respect the grain
+        ASSERT_EQ(0u, static_cast<std::size_t>(block.data() - values.data()) % s_forEachAlignment);
+
+        const auto last = block.end() == values.data() + values.size();
+        ASSERT_TRUE(last || block.size() >= 1000u);
+    }
+}
+
+TEST_F(parallel_for_each_test, ConstVector)
+{
+    auto values = std::vector<int>(50000);
+    std::iota(values.begin(), values.end(), 0);
+
+    const auto & input = values;
+    auto sums = std::vector<long long>(50000, 0);
+
+    parallel_for_each(input, [&input, &sums] (Span<const int> block)
+        {
+            for (auto & value : block)
+                sums[&value - input.data()] = value + 1;
+        });
+
+    for (auto i = 0u; i < sums.size(); ++i)
+        ASSERT_EQ(static_cast<long long>(i) + 1, sums[i]);
+}
+
+TEST_F(parallel_for_each_test, StructureOfArrays)
+{
+    const auto size = std::size_t(70001);
+    auto x = std::vector<float>(size), v = std::vector<float>(size);
+
+    for (auto i = 0u; i < size; ++i)
+    {
+        x[i] = static_cast<float>(i);
+        v[i] = 0.5f;
+    }
+
+    const auto view = makeSoAView(x, v);
+    ASSERT_EQ(size, view.size());
+
+    parallel_for_each(view, [] (const SoAView<float, float> & block)
+        {
+            const auto x = block.get<0>();
+            const auto v = block.get<1>();
+
+            for (auto i = std::size_t(0); i < block.size(); ++i)
+                x[i] += 2.0f * v[i];
+        });
+
+    for (auto i = 0u; i < size; ++i)
+        ASSERT_EQ(static_cast<float>(i) + 1.0f, x[i]);
+
+    const auto tail = view.subview(size - 10, 10);
+    ASSERT_EQ(10u, tail.size());
+    ASSERT_EQ(x.data() + size - 10, tail.get<0>().data());
+    ASSERT_EQ(v.data() + size - 10, tail.get<1>().data());
+}
@@ -1,8 +1,17 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
 
 
 using namespace threadingzeug;
@@ -35,3 +44,187 @@ TEST_F(parallel_for_test, IncrementVector)
 
     ASSERT_TRUE(allTrue);
 }
+
+TEST_F(parallel_for_test, ChunkedCoversRangeOnce)
+{
+    const auto policies = { SchedulingPolicy::Static, SchedulingPolicy::Dynamic, SchedulingPolicy::Guided };
+
+    for (auto policy : policies)
+    {
+        auto vec = std::vector<int>(10007, 0);
+
+        parallel_for(Range<int>(5, 10000), 64, [&vec] (int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                    ++vec[i];
+            }, policy);
+
+        for (auto i = 0; i < static_cast<int>(vec.size()); ++i)
+            ASSERT_EQ(i >= 5 && i < 10000 ? 1 : 0, vec[i]);
+    }
+}
+
+TEST_F(parallel_for_test, ChunkedRespectsGrain)
+{
+    const auto policies = { SchedulingPolicy::Static, SchedulingPolicy::Dynamic, SchedulingPolicy::Guided };
+    const auto sizes = { 1000, 150, 1050, 99 };
+
+    ThreadPool::configure(3);
+
+    for (auto policy : policies)
+    {
+        for (auto size : sizes)
+        {
+            auto blocks = std::vector<std::pair<int, int>>();
+            std::mutex mutex;
+
+            parallel_for(Range<int>(0, size), 100, [&blocks, &mutex] (int begin, int end)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    blocks.emplace_back(begin, end);
+                }, policy);
+
+            std::sort(blocks.begin(), blocks.end());
+
+            // only the last block may be smaller than grain
+            for (auto i = 0u; i + 1 < blocks.size(); ++i)
+                ASSERT_LE(100, blocks[i].second - blocks[i].first);
+
+            ASSERT_EQ(size, blocks.back().second);
+        }
+    }
+
+    ThreadPool::configure(0);
+}
+
+TEST_F(parallel_for_test, WideIndexType)
+{
+    const auto offset = std::int64_t(1) << 40;
+    std::atomic<std::int64_t> sum(0);
+
+    parallel_for(offset, offset + 1000, [&sum, offset] (std::int64_t i)
+        {
+            sum += i - offset;
+        });
+
+    ASSERT_EQ(999 * 1000 / 2, sum);
+}
+
+TEST_F(parallel_for_test, VectorOverload)
+{
+    auto vec = std::vector<int>(1000, 1);
+
+    parallel_for<int>(vec, [] (int & value)
+        {
+            value *= 2;
+        });
+
+    for (auto value : vec)
+        ASSERT_EQ(2, value);
+}
+
+TEST_F(parallel_for_test, NestedLoopsShareWorkers)
+{
+    ThreadPool::configure(3);
+
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    auto vec = std::vector<int>(8 * 8 * 8, 0);
+
+    parallel_for(0, 8, [&] (int i)
+        {
+            parallel_for(0, 8, [&] (int j)
+                {
+                    parallel_for(0, 8, [&] (int k)
+                        {
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                threads.insert(std::this_thread::get_id());
+                            }
+
+                            std::this_thread::sleep_for(std::chrono::microseconds(100));
+                            ++vec[(i * 8 + j) * 8 + k];
+                        });
+                });
+        });
+
+    // the three workers and the calling thread
+    ASSERT_LE(threads.size(), 4u);
+
+    for (auto value : vec)
+        ASSERT_EQ(1, value);
+
+    ThreadPool::configure(0);
+}
+
+TEST_F(parallel_for_test, RethrowsFirstException)
+{
+    ThreadPool::configure(7);
+
+    for (auto policy : { SchedulingPolicy::Static, SchedulingPolicy::Dynamic, SchedulingPolicy::Guided })
+    {
+        std::atomic<int> executed(0);
+
+        ASSERT_THROW(parallel_for(Range<int>(0, 1 << 16), 64, [&executed] (int begin, int)
+            {
+                ++executed;
+                if (begin == 0)
+                    throw std::runtime_error("failed");
+            }, policy), std::runtime_error);
+
+        // the pool remains usable after an exception
+        parallel_for(Range<int>(0, 1 << 16), 64, [&executed] (int, int) { ++executed; }, policy);
+    }
+
+    ThreadPool::configure(0);
+}
+
+TEST_F(parallel_for_test, CancellationSkipsRemainingBlocks)
+{
+    ThreadPool::configure(7);
+
+    const auto size = 1 << 20;
+    std::atomic<int> blocks(0);
+    CancellationToken token;
+
+    parallel_for(Range<int>(0, size), 16, [&] (int, int)
+        {
+            if (++blocks == 10)
+                token.cancel();
+        }, SchedulingPolicy::Dynamic, token);
+
+    ASSERT_TRUE(token.cancelled());
+    // at most one block per participant is claimed after the cancellation
+    ASSERT_LE(blocks.load(), 10 + 8);
+
+    ThreadPool::configure(0);
+}
+
+TEST_F(parallel_for_test, PinnedKeepsIndicesOnWorkers)
+{
+    ThreadPool::configure(5, Placement::Compact);
+
+    auto & pool = ThreadPool::instance();
+    const auto size = 1000;
+    auto workers = std::vector<int>(size, -1);
+
+    parallel_for(Range<int>(0, size), 1, [&] (int begin, int end)
+        {
+            for (auto i = begin; i < end; ++i)
+                workers[i] = pool.currentWorker();
+        }, SchedulingPolicy::Pinned);
+
+    for (auto repetition = 0; repetition < 10; ++repetition)
+    {
+        parallel_for(Range<int>(0, size), 1, [&] (int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                    ASSERT_EQ(workers[i], pool.currentWorker());
+            }, SchedulingPolicy::Pinned);
+    }
+
+    for (auto worker : workers)
+        ASSERT_GE(worker, 0);
+
+    ThreadPool::configure(0);
+}
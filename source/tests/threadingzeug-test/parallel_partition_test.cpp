@@ -0,0 +1,71 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <threadingzeug/parallelpartition.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class parallel_partition_test : public testing::Test
+{
+public:
+    parallel_partition_test()
+    {
+        ThreadPool::configure(7);
+    }
+
+    ~parallel_partition_test()
+    {
+        ThreadPool::configure(0);
+    }
+
+protected:
+};
+
+TEST_F(parallel_partition_test, StablePartition)
+{
+    auto values = std::vector<int>(100000);
+    for (auto i = 0u; i < values.size(); ++i)
+        values[i] = static_cast<int>((i * 7919) % 100003);
+
+    const auto isEven = [] (int value) { return value % 2 == 0; };
+
+    auto expected = values;
+    const auto expectedPoint = std::stable_partition(expected.begin(), expected.end(), isEven) - expected.begin();
+
+    const auto point = parallel_partition(values, isEven);
+
+    ASSERT_EQ(static_cast<std::size_t>(expectedPoint), point);
+    ASSERT_EQ(expected, values);
+}
+
+TEST_F(parallel_partition_test, CopyIf)
+{
+    auto input = std::vector<int>(100000);
+    for (auto i = 0u; i < input.size(); ++i)
+        input[i] = static_cast<int>(i);
+
+    const auto isMultipleOfThree = [] (int value) { return value % 3 == 0; };
+
+    auto expected = std::vector<int>();
+    std::copy_if(input.begin(), input.end(), std::back_inserter(expected), isMultipleOfThree);
+
+    auto output = std::vector<int>(5, -1);
+    parallel_copy_if(input, output, isMultipleOfThree);
+
+    ASSERT_EQ(expected, output);
+}
+
+TEST_F(parallel_partition_test, NothingSelected)
+{
+    auto values = std::vector<int>(1000, 1);
+    auto output = std::vector<int>();
+
+    ASSERT_EQ(0u, parallel_partition(values, [] (int value) { return value == 0; }));
+    parallel_copy_if(values, output, [] (int value) { return value == 0; });
+
+    ASSERT_TRUE(output.empty());
+}
@@ -0,0 +1,110 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <threadingzeug/parallelreduce.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class parallel_reduce_test : public testing::Test
+{
+public:
+    parallel_reduce_test()
+    {
+    }
+
+protected:
+};
+
+TEST_F(parallel_reduce_test, Sum)
+{
+    const auto sum = parallel_reduce(Range<std::int64_t>(0, 100000), std::int64_t(0),
+        [] (std::int64_t i) { return i; },
+        [] (std::int64_t a, std::int64_t b) { return a + b; });
+
+    ASSERT_EQ(std::int64_t(99999) * 100000 / 2, sum);
+}
+
+TEST_F(parallel_reduce_test, ConcurrentCallersOutsideThePool)
+{
+    // threads outside the pool run blocks of each other's reductions while they wait
+    auto sums = std::vector<std::int64_t>(4);
+    auto callers = std::vector<std::thread>();
+
+    for (auto c = 0u; c < sums.size(); ++c)
+    {
+        callers.emplace_back([&sums, c] ()
+        {
+            for (auto repetition = 0; repetition < 20; ++repetition)
+            {
+                sums[c] = parallel_reduce(Range<std::int64_t>(0, 100000), std::int64_t(0),
+                    [] (std::int64_t i) { return i; },
+                    [] (std::int64_t a, std::int64_t b) { return a + b; });
+
+                if (sums[c] != std::int64_t(99999) * 100000 / 2)
+                    return;
+            }
+        });
+    }
+
+    for (auto & caller : callers)
+        caller.join();
+
+    for (const auto sum : sums)
+        ASSERT_EQ(std::int64_t(99999) * 100000 / 2, sum);
+}
+
+TEST_F(parallel_reduce_test, EmptyRangeYieldsIdentity)
+{
+    const auto result = parallel_reduce(Range<int>(5, 5), 42,
+        [] (int i) { return i; },
+        [] (int a, int b) { return a + b; });
+
+    ASSERT_EQ(42, result);
+}
+
+TEST_F(parallel_reduce_test, TransformReduceMinMax)
+{
+    auto values = std::vector<float>(50000);
+    for (auto i = 0u; i < values.size(); ++i)
+        values[i] = static_cast<float>((i * 7919) % 50000);
+
+    typedef std::pair<float, float> Bounds;
+
+    const auto bounds = parallel_transform_reduce(values,
+        Bounds(std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()),
+        [] (float value) { return Bounds(value, value); },
+        [] (const Bounds & a, const Bounds & b) { return Bounds(std::min(a.first, b.first), std::max(a.second, b.second)); });
+
+    ASSERT_EQ(0.0f, bounds.first);
+    ASSERT_EQ(49999.0f, bounds.second);
+}
+
+TEST_F(parallel_reduce_test, DeterministicIndependentOfThreadCount)
+{
+    auto values = std::vector<float>(1000000);
+    for (auto i = 0u; i < values.size(); ++i)
+        values[i] = 1.0f / static_cast<float>(i + 1);
+
+    const auto sum = [&values] ()
+    {
+        return parallel_transform_reduce(values, 0.0f,
+            [] (float value) { return value; },
+            [] (float a, float b) { return a + b; }, ReductionOrder::Deterministic);
+    };
+
+    ThreadPool::configure(1);
+    const auto reference = sum();
+
+    ThreadPool::configure(7);
+    for (auto i = 0; i < 10; ++i)
+        ASSERT_EQ(reference, sum());
+
+    ThreadPool::configure(0);
+}
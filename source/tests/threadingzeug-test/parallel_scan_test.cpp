@@ -0,0 +1,68 @@
+#include <gmock/gmock.h>
+
+#include <numeric>
+#include <vector>
+
+#include <threadingzeug/parallelscan.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class parallel_scan_test : public testing::Test
+{
+public:
+    parallel_scan_test()
+    {
+        ThreadPool::configure(7);
+    }
+
+    ~parallel_scan_test()
+    {
+        ThreadPool::configure(0);
+    }
+
+protected:
+};
+
+TEST_F(parallel_scan_test, InclusiveScan)
+{
+    auto input = std::vector<int>(100003);
+    for (auto i = 0u; i < input.size(); ++i)
+        input[i] = static_cast<int>(i % 13);
+
+    auto expected = std::vector<int>(input.size());
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+
+    auto output = std::vector<int>();
+    parallel_inclusive_scan(input, output);
+
+    ASSERT_EQ(expected, output);
+}
+
+TEST_F(parallel_scan_test, ExclusiveScanInPlace)
+{
+    auto values = std::vector<int>(50000, 2);
+
+    parallel_exclusive_scan(values, values, 10);
+
+    for (auto i = 0u; i < values.size(); ++i)
+        ASSERT_EQ(10 + 2 * static_cast<int>(i), values[i]);
+}
+
+TEST_F(parallel_scan_test, CustomCombine)
+{
+    auto input = std::vector<int>(30000);
+    for (auto i = 0u; i < input.size(); ++i)
+        input[i] = static_cast<int>((i * 7919) % 30011);
+
+    auto output = std::vector<int>();
+    parallel_inclusive_scan(input, output, [] (int a, int b) { return std::max(a, b); });
+
+    auto maximum = input.front();
+    for (auto i = 0u; i < input.size(); ++i)
+    {
+        maximum = std::max(maximum, input[i]);
+        ASSERT_EQ(maximum, output[i]);
+    }
+}
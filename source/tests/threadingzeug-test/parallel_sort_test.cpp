@@ -0,0 +1,94 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <threadingzeug/parallelsort.h>
+#include <threadingzeug/ThreadPool.h>
+
+
+using namespace threadingzeug;
+
+class parallel_sort_test : public testing::Test
+{
+public:
+    parallel_sort_test()
+    : m_random(42)
+    {
+        ThreadPool::configure(7);
+    }
+
+    ~parallel_sort_test()
+    {
+        ThreadPool::configure(0);
+    }
+
+protected:
+    std::mt19937 m_random;
+};
+
+TEST_F(parallel_sort_test, StableMergeSort)
+{
+    typedef std::pair<int, int> Entry;
+
+    auto values = std::vector<Entry>(200000);
+    for (auto i = 0u; i < values.size(); ++i)
+        values[i] = Entry(static_cast<int>(m_random() % 100), static_cast<int>(i));
+
+    auto expected = values;
+    const auto byKey = [] (const Entry & a, const Entry & b) { return a.first < b.first; };
+
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+    parallel_sort(values, byKey);
+
+    ASSERT_EQ(expected, values);
+}
+
+TEST_F(parallel_sort_test, RadixSortSignedIntegers)
+{
+    auto values = std::vector<std::int32_t>(200000);
+    for (auto & value : values)
+        value = static_cast<std::int32_t>(m_random());
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel_radix_sort(values);
+
+    ASSERT_EQ(expected, values);
+}
+
+TEST_F(parallel_sort_test, RadixSortFloats)
+{
+    auto distribution = std::uniform_real_distribution<double>(-1000.0, 1000.0);
+
+    auto values = std::vector<double>(200000);
+    for (auto & value : values)
+        value = distribution(m_random);
+
+    values[0] = std::numeric_limits<double>::infinity();
+    values[1] = -std::numeric_limits<double>::infinity();
+    values[2] = 0.0;
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel_radix_sort(values);
+
+    ASSERT_EQ(expected, values);
+}
+
+TEST_F(parallel_sort_test, RadixSortSmallKeys)
+{
+    auto values = std::vector<std::uint16_t>(100000);
+    for (auto & value : values)
+        value = static_cast<std::uint16_t>(m_random() % 50);
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel_radix_sort(values);
+
+    ASSERT_EQ(expected, values);
+}
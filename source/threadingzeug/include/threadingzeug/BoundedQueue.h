@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/** \brief Lock-free bounded queue for any number of producers and consumers.
+
+    The queue is a ring of cells, each with a sequence number telling producers
+    and consumers whether the cell is free or filled for their current lap.
+    Both operations claim a position with a single compare-and-swap and never
+    block or allocate; a full (or empty) queue makes tryPush() (or tryPop())
+    return false instead.
+
+    \code{.cpp}
+
+        BoundedQueue<Job> jobs(1024);
+
+        while (!jobs.tryPush(job))
+            std::this_thread::yield();
+
+    \endcode
+
+    T must be default-constructible and move-assignable.
+
+    \see Pipeline
+*/
+template <typename T>
+class BoundedQueue
+{
+public:
+    /**
+     * \param capacity
+     *     Maximum number of values; rounded up to a power of two
+     */
+    explicit BoundedQueue(std::size_t capacity);
+
+    BoundedQueue(const BoundedQueue &) = delete;
+    BoundedQueue & operator=(const BoundedQueue &) = delete;
+
+    std::size_t capacity() const;
+
+    bool tryPush(T value);
+    bool tryPop(T & value);
+
+protected:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    static const std::size_t s_cacheLineSize = 64;
+
+protected:
+    std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+
+    // producers and consumers contend for different cache lines
+    char m_padding0[s_cacheLineSize];
+    std::atomic<std::size_t> m_enqueuePosition;
+    char m_padding1[s_cacheLineSize];
+    std::atomic<std::size_t> m_dequeuePosition;
+    char m_padding2[s_cacheLineSize];
+};
+
+} // namespace threadingzeug
+
+#include <threadingzeug/BoundedQueue.hpp>
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <threadingzeug/BoundedQueue.h>
+
+#include <utility>
+
+namespace threadingzeug
+{
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(std::size_t capacity)
+: m_mask(0)
+, m_enqueuePosition(0)
+, m_dequeuePosition(0)
+{
+    auto size = std::size_t(2);
+    while (size < capacity)
+        size *= 2;
+
+    m_mask = size - 1;
+    m_cells.reset(new Cell[size]);
+
+    // a cell is free for the producer at position i while its sequence is i
+    for (auto i = std::size_t(0); i < size; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::capacity() const
+{
+    return m_mask + 1;
+}
+
+template <typename T>
+bool BoundedQueue<T>::tryPush(T value)
+{
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto & cell = m_cells[position & m_mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell.value = std::move(value);
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the cell still holds the value of the previous lap
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool BoundedQueue<T>::tryPop(T & value)
+{
+    auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto & cell = m_cells[position & m_mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+        if (difference == 0)
+        {
+            if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                value = std::move(cell.value);
+                cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the cell has not been filled in this lap yet
+            return false;
+        }
+        else
+        {
+            position = m_dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace threadingzeug
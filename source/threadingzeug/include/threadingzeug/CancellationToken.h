@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/** \brief Shared flag to stop a parallel loop early.
+
+    Copies of a token share their state, so a token can be passed to a loop
+    and cancelled from within its callback or from another thread. Once
+    cancelled, the loop does not start any further blocks; blocks already
+    running finish unless their callback checks cancelled() itself.
+    The Dynamic and Guided scheduling policies are therefore best suited for
+    cancellation, since Static starts all blocks at once.
+
+    \code{.cpp}
+
+        CancellationToken token;
+
+        parallel_for(Range<int>(0, size), 1024, [&] (int begin, int end)
+        {
+            for (auto i = begin; i < end && !token.cancelled(); ++i)
+                if (matches(i))
+                    token.cancel();
+        }, SchedulingPolicy::Dynamic, token);
+
+    \endcode
+
+    \see parallel_for
+    \see parallel_find_if
+*/
+class THREADINGZEUG_API CancellationToken
+{
+public:
+    CancellationToken();
+
+    void cancel();
+    bool cancelled() const;
+
+protected:
+    std::shared_ptr<std::atomic<bool>> m_cancelled;
+};
+
+} // namespace threadingzeug
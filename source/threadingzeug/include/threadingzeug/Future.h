@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+class ThreadPool;
+
+namespace util
+{
+
+/**
+ * Shared state of a Future, independent of the value type.
+ */
+class THREADINGZEUG_API AbstractFutureState
+{
+public:
+    AbstractFutureState();
+    virtual ~AbstractFutureState();
+
+    bool ready() const;
+    void wait() const;
+
+    std::exception_ptr exception() const;
+    void setException(std::exception_ptr exception);
+
+    /**
+     * Calls the continuation once the state is ready: immediately if it already is,
+     * otherwise on the thread that makes it ready.
+     */
+    void onReady(std::function<void()> continuation);
+
+protected:
+    void markReady();
+
+protected:
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_readyCondition;
+    std::atomic<bool> m_ready;
+    std::exception_ptr m_exception;
+    std::vector<std::function<void()>> m_continuations;
+    // the pool of a worker helping in wait(), woken by markReady()
+    mutable ThreadPool * m_helpingPool;
+};
+
+template <typename T>
+class FutureState : public AbstractFutureState
+{
+public:
+    void setValue(T value);
+    const T & value() const;
+
+protected:
+    std::unique_ptr<T> m_value;
+};
+
+template <>
+class FutureState<void> : public AbstractFutureState
+{
+public:
+    void setValue();
+    void value() const;
+};
+
+template <typename T>
+struct FutureTraits
+{
+    typedef const T & Reference;
+
+    template <typename Callback>
+    static auto call(Callback & callback, const FutureState<T> & state) -> decltype(callback(state.value()))
+    {
+        return callback(state.value());
+    }
+};
+
+template <>
+struct FutureTraits<void>
+{
+    typedef void Reference;
+
+    template <typename Callback>
+    static auto call(Callback & callback, const FutureState<void> &) -> decltype(callback())
+    {
+        return callback();
+    }
+};
+
+template <typename T, typename Callback>
+struct ContinuationResult
+{
+    typedef typename std::decay<decltype(FutureTraits<T>::call(std::declval<Callback &>(), std::declval<const FutureState<T> &>()))>::type Type;
+};
+
+} // namespace util
+
+template <typename T>
+class Future;
+
+/**
+ * \brief Result of a task running on the ThreadPool.
+
+    Futures are shared handles: copies refer to the same result and get() may be
+    called repeatedly. Waiting on a worker thread of the ThreadPool executes other
+    pending tasks instead of blocking the worker.
+
+    \code{.cpp}
+
+        auto data = spawn([] () { return iozeug::readFile("scene.json"); });
+        auto scene = data.then([] (const std::string & json) { return parse(json); });
+
+        render(scene.get());
+
+    \endcode
+
+    \see spawn
+    \see when_all
+    \see when_any
+    \see TaskGraph
+ */
+template <typename T>
+class Future
+{
+public:
+    typedef T ValueType;
+
+public:
+    Future();
+    explicit Future(std::shared_ptr<util::FutureState<T>> state);
+
+    bool valid() const;
+    bool ready() const;
+
+    void wait() const;
+
+    /**
+     * Waits for the result and returns it; rethrows the exception thrown by the task instead.
+     */
+    typename util::FutureTraits<T>::Reference get() const;
+
+    /**
+     * Spawns callback(get()) (or callback() for Future<void>) once this future is ready.
+     * An exception of this future is passed on to the returned future without calling callback.
+     */
+    template <typename Callback>
+    Future<typename util::ContinuationResult<T, Callback>::Type> then(Callback callback) const;
+
+    std::shared_ptr<util::FutureState<T>> state() const;
+
+protected:
+    std::shared_ptr<util::FutureState<T>> m_state;
+};
+
+/**
+ * Runs task() on the ThreadPool and returns a Future for its result.
+ */
+template <typename Task>
+auto spawn(Task task) -> Future<typename std::decay<decltype(task())>::type>;
+
+/**
+ * Returns a future that becomes ready when all futures are ready.
+ * It carries the first exception (in order of the futures) if any of them failed.
+ */
+template <typename T>
+Future<void> when_all(const std::vector<Future<T>> & futures);
+
+/**
+ * Returns a future for the index of the first future that becomes ready.
+ * futures must not be empty.
+ */
+template <typename T>
+Future<std::size_t> when_any(const std::vector<Future<T>> & futures);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/Future.hpp>
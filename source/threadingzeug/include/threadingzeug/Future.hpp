@@ -0,0 +1,222 @@
+#pragma once
+
+#include <threadingzeug/Future.h>
+
+#include <atomic>
+#include <cassert>
+#include <utility>
+
+#include <threadingzeug/ThreadPool.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+template <typename T>
+void FutureState<T>::setValue(T value)
+{
+    m_value.reset(new T(std::move(value)));
+    markReady();
+}
+
+template <typename T>
+const T & FutureState<T>::value() const
+{
+    return *m_value;
+}
+
+/**
+ * Stores the result of task() or the exception it throws in the state.
+ */
+template <typename T>
+struct Fulfil
+{
+    template <typename Task>
+    static void run(FutureState<T> & state, Task & task)
+    {
+        try
+        {
+            state.setValue(task());
+        }
+        catch (...)
+        {
+            state.setException(std::current_exception());
+        }
+    }
+};
+
+template <>
+struct Fulfil<void>
+{
+    template <typename Task>
+    static void run(FutureState<void> & state, Task & task)
+    {
+        try
+        {
+            task();
+            state.setValue();
+        }
+        catch (...)
+        {
+            state.setException(std::current_exception());
+        }
+    }
+};
+
+} // namespace util
+
+template <typename T>
+Future<T>::Future()
+{
+}
+
+template <typename T>
+Future<T>::Future(std::shared_ptr<util::FutureState<T>> state)
+: m_state(std::move(state))
+{
+}
+
+template <typename T>
+bool Future<T>::valid() const
+{
+    return m_state != nullptr;
+}
+
+template <typename T>
+bool Future<T>::ready() const
+{
+    return m_state && m_state->ready();
+}
+
+template <typename T>
+void Future<T>::wait() const
+{
+    m_state->wait();
+}
+
+template <typename T>
+typename util::FutureTraits<T>::Reference Future<T>::get() const
+{
+    m_state->wait();
+
+    if (m_state->exception())
+        std::rethrow_exception(m_state->exception());
+
+    return m_state->value();
+}
+
+template <typename T>
+template <typename Callback>
+Future<typename util::ContinuationResult<T, Callback>::Type> Future<T>::then(Callback callback) const
+{
+    typedef typename util::ContinuationResult<T, Callback>::Type Result;
+
+    auto source = m_state;
+    auto target = std::make_shared<util::FutureState<Result>>();
+
+    source->onReady([source, target, callback] ()
+    {
+        if (source->exception())
+        {
+            target->setException(source->exception());
+            return;
+        }
+
+        ThreadPool::instance().submit([source, target, callback] () mutable
+        {
+            auto task = [&source, &callback] () -> Result
+            {
+                return util::FutureTraits<T>::call(callback, *source);
+            };
+
+            util::Fulfil<Result>::run(*target, task);
+        });
+    });
+
+    return Future<Result>(target);
+}
+
+template <typename T>
+std::shared_ptr<util::FutureState<T>> Future<T>::state() const
+{
+    return m_state;
+}
+
+template <typename Task>
+auto spawn(Task task) -> Future<typename std::decay<decltype(task())>::type>
+{
+    typedef typename std::decay<decltype(task())>::type Result;
+
+    auto state = std::make_shared<util::FutureState<Result>>();
+
+    ThreadPool::instance().submit([state, task] () mutable
+    {
+        util::Fulfil<Result>::run(*state, task);
+    });
+
+    return Future<Result>(state);
+}
+
+template <typename T>
+Future<void> when_all(const std::vector<Future<T>> & futures)
+{
+    auto result = std::make_shared<util::FutureState<void>>();
+
+    if (futures.empty())
+    {
+        result->setValue();
+        return Future<void>(result);
+    }
+
+    auto pending = std::make_shared<std::atomic<std::size_t>>(futures.size());
+    auto states = std::make_shared<std::vector<std::shared_ptr<util::FutureState<T>>>>();
+
+    for (const auto & future : futures)
+        states->push_back(future.state());
+
+    for (const auto & state : *states)
+    {
+        state->onReady([states, pending, result] ()
+        {
+            if (--*pending > 0)
+                return;
+
+            for (const auto & state : *states)
+            {
+                if (state->exception())
+                {
+                    result->setException(state->exception());
+                    return;
+                }
+            }
+
+            result->setValue();
+        });
+    }
+
+    return Future<void>(result);
+}
+
+template <typename T>
+Future<std::size_t> when_any(const std::vector<Future<T>> & futures)
+{
+    assert(!futures.empty());
+
+    auto result = std::make_shared<util::FutureState<std::size_t>>();
+    auto claimed = std::make_shared<std::atomic<bool>>(false);
+
+    for (auto i = std::size_t(0); i < futures.size(); ++i)
+    {
+        futures[i].state()->onReady([i, claimed, result] ()
+        {
+            if (!claimed->exchange(true))
+                result->setValue(i);
+        });
+    }
+
+    return Future<std::size_t>(result);
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/BoundedQueue.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+/**
+ * State shared by the stages of a Pipeline.
+ */
+struct THREADINGZEUG_API PipelineState
+{
+    explicit PipelineState(std::size_t capacity);
+
+    bool finished() const;
+
+    /** Called whenever items were passed on or the pipeline finished; wakes idle threads. */
+    void notifyProgress();
+    /** Waits until notifyProgress was called after seen was read from progress, or the pipeline finished. */
+    void waitForProgress(std::uint64_t seen);
+
+    /** Maximum number of items in flight */
+    const std::size_t capacity;
+
+    std::atomic<std::size_t> inFlight;
+    std::atomic<bool> exhausted;
+    std::atomic<bool> failed;
+
+    std::atomic<std::uint64_t> progress;
+    std::atomic<unsigned> sleeping;
+    std::mutex mutex;
+    std::condition_variable progressCondition;
+};
+
+template <typename T>
+struct PipelineToken
+{
+    std::size_t sequence;
+    T value;
+};
+
+template <typename T>
+using PipelineQueue = BoundedQueue<PipelineToken<T>>;
+
+/**
+ * Restores the source order of the items passing a serial stage.
+ * Holds at most capacity items, since no more are in flight.
+ */
+template <typename T>
+class PipelineReorderBuffer
+{
+public:
+    explicit PipelineReorderBuffer(std::size_t capacity);
+
+    void insert(PipelineToken<T> && token);
+    bool takeNext(PipelineToken<T> & token);
+
+protected:
+    std::vector<PipelineToken<T>> m_slots;
+    std::vector<char> m_present;
+    std::size_t m_next;
+};
+
+class THREADINGZEUG_API AbstractPipelineStage
+{
+public:
+    /**
+     * \param parallelism
+     *     Maximum number of threads processing items of this stage at once; 0 means no limit.
+     *     Stages with parallelism 1 process items in source order.
+     */
+    AbstractPipelineStage(std::shared_ptr<PipelineState> state, unsigned parallelism);
+    virtual ~AbstractPipelineStage();
+
+    /**
+     * Processes available items unless the stage is already busy on as many threads as its parallelism allows.
+     * \return true if any item was processed
+     */
+    bool process();
+
+protected:
+    virtual bool processItems() = 0;
+
+protected:
+    std::shared_ptr<PipelineState> m_state;
+    const unsigned m_parallelism;
+    std::atomic<unsigned> m_active;
+};
+
+template <typename Out, typename Source>
+class PipelineSource;
+
+template <typename In, typename Out, typename Transform>
+class PipelineTransform;
+
+template <typename In, typename Sink>
+class PipelineSink;
+
+} // namespace util
+
+class Pipeline;
+
+/**
+ * \brief Intermediate result of building a Pipeline whose last stage produces items of type T.
+ */
+template <typename T>
+class PipelineBuilder
+{
+public:
+    /**
+     * Appends a stage that turns every item into transform(std::move(item)).
+     *
+     * \param parallelism
+     *     Maximum number of threads running transform at once; 0 means no limit.
+     *     A stage with parallelism 1 handles the items one after another, in source order.
+     */
+    template <typename Transform>
+    PipelineBuilder<typename std::decay<decltype(std::declval<Transform &>()(std::declval<T &&>()))>::type> stage(unsigned parallelism, Transform transform);
+
+    /**
+     * Completes the pipeline with a stage that calls sink(std::move(item)) for every item, one after another and in source order.
+     */
+    template <typename Sink>
+    Pipeline sink(Sink sink);
+
+protected:
+    template <typename U>
+    friend class PipelineBuilder;
+    friend class Pipeline;
+
+    PipelineBuilder(std::shared_ptr<util::PipelineState> state, std::vector<std::unique_ptr<util::AbstractPipelineStage>> stages, util::PipelineQueue<T> * output);
+
+protected:
+    std::shared_ptr<util::PipelineState> m_state;
+    std::vector<std::unique_ptr<util::AbstractPipelineStage>> m_stages;
+    util::PipelineQueue<T> * m_output;
+};
+
+/** \brief Streams items from a source through a chain of stages into a sink, using the ThreadPool.
+
+    At most capacity items are in flight at once. A slow stage thus holds up the
+    source instead of letting items pile up in memory (backpressure). Stages pass
+    items on through lock-free BoundedQueue%s; serial stages and the sink restore
+    the source order.
+
+    Every thread of the ThreadPool, including the calling one, runs whatever stage
+    has items to process, so a pipeline cannot run out of threads for any stage
+    and never blocks a worker. Threads without items to process, e.g., while the
+    source waits for input, sleep until a stage passes items on.
+
+    \code{.cpp}
+
+        std::ifstream file("points.csv");
+
+        auto pipeline = Pipeline::source<std::string>([&file] (std::string & line)
+            {
+                return static_cast<bool>(std::getline(file, line));
+            })
+            .stage(0, [] (std::string && line) { return parsePoint(line); })
+            .stage(1, [&bounds] (Point && point) { bounds.extend(point); return point; })
+            .sink([&points] (Point && point) { points.push_back(point); });
+
+        pipeline.run();
+
+    \endcode
+
+    Items must be default-constructible and movable. If a stage throws, the
+    pipeline stops and run() rethrows the first exception.
+
+    \see BoundedQueue
+*/
+class THREADINGZEUG_API Pipeline
+{
+public:
+    static const std::size_t s_defaultCapacity = 64;
+
+    /**
+     * Starts a pipeline with a source, called one item at a time as long as it returns true.
+     *
+     * \param source
+     *     Callable with signature bool(T & item) that sets item and returns true, or returns false once exhausted
+     * \param capacity
+     *     Maximum number of items in flight
+     */
+    template <typename T, typename Source>
+    static PipelineBuilder<T> source(Source source, std::size_t capacity = s_defaultCapacity);
+
+public:
+    Pipeline(Pipeline && other);
+    ~Pipeline();
+
+    /**
+     * Runs the pipeline until the source is exhausted and every item has reached the sink.
+     */
+    void run();
+
+protected:
+    template <typename T>
+    friend class PipelineBuilder;
+
+    Pipeline(std::shared_ptr<util::PipelineState> state, std::vector<std::unique_ptr<util::AbstractPipelineStage>> stages);
+
+protected:
+    std::shared_ptr<util::PipelineState> m_state;
+    std::vector<std::unique_ptr<util::AbstractPipelineStage>> m_stages;
+};
+
+} // namespace threadingzeug
+
+#include <threadingzeug/Pipeline.hpp>
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <threadingzeug/Pipeline.h>
+
+#include <cassert>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+template <typename T>
+PipelineReorderBuffer<T>::PipelineReorderBuffer(std::size_t capacity)
+: m_slots(capacity)
+, m_present(capacity, 0)
+, m_next(0)
+{
+}
+
+template <typename T>
+void PipelineReorderBuffer<T>::insert(PipelineToken<T> && token)
+{
+    const auto slot = token.sequence % m_slots.size();
+    assert(!m_present[slot]);
+
+    m_slots[slot] = std::move(token);
+    m_present[slot] = 1;
+}
+
+template <typename T>
+bool PipelineReorderBuffer<T>::takeNext(PipelineToken<T> & token)
+{
+    const auto slot = m_next % m_slots.size();
+
+    if (!m_present[slot])
+        return false;
+
+    token = std::move(m_slots[slot]);
+    m_present[slot] = 0;
+    ++m_next;
+
+    return true;
+}
+
+template <typename Out, typename Source>
+class PipelineSource : public AbstractPipelineStage
+{
+public:
+    PipelineSource(std::shared_ptr<PipelineState> state, Source source)
+    : AbstractPipelineStage(state, 1)
+    , m_source(std::move(source))
+    , m_output(new PipelineQueue<Out>(state->capacity))
+    , m_next(0)
+    {
+    }
+
+    PipelineQueue<Out> * output()
+    {
+        return m_output.get();
+    }
+
+protected:
+    virtual bool processItems()
+    {
+        auto processed = false;
+
+        while (!m_state->exhausted && m_state->inFlight < m_state->capacity)
+        {
+            PipelineToken<Out> token;
+
+            if (!m_source(token.value))
+            {
+                m_state->exhausted = true;
+                m_state->notifyProgress();
+                break;
+            }
+
+            token.sequence = m_next++;
+            ++m_state->inFlight;
+
+            const auto pushed = m_output->tryPush(std::move(token));
+            assert(pushed);
+            (void)pushed;
+
+            m_state->notifyProgress();
+            processed = true;
+        }
+
+        return processed;
+    }
+
+protected:
+    Source m_source;
+    std::unique_ptr<PipelineQueue<Out>> m_output;
+    std::size_t m_next;
+};
+
+template <typename In, typename Out, typename Transform>
+class PipelineTransform : public AbstractPipelineStage
+{
+public:
+    PipelineTransform(std::shared_ptr<PipelineState> state, unsigned parallelism, PipelineQueue<In> * input, Transform transform)
+    : AbstractPipelineStage(state, parallelism)
+    , m_transform(std::move(transform))
+    , m_input(input)
+    , m_output(new PipelineQueue<Out>(state->capacity))
+    , m_reorder(parallelism == 1 ? state->capacity : 0)
+    {
+    }
+
+    PipelineQueue<Out> * output()
+    {
+        return m_output.get();
+    }
+
+protected:
+    virtual bool processItems()
+    {
+        PipelineToken<In> token;
+
+        if (m_parallelism != 1)
+        {
+            if (!m_input->tryPop(token))
+                return false;
+
+            forward(token);
+            return true;
+        }
+
+        while (m_input->tryPop(token))
+            m_reorder.insert(std::move(token));
+
+        auto processed = false;
+
+        while (m_reorder.takeNext(token))
+        {
+            forward(token);
+            processed = true;
+        }
+
+        return processed;
+    }
+
+    void forward(PipelineToken<In> & token)
+    {
+        const auto pushed = m_output->tryPush(PipelineToken<Out>{ token.sequence, m_transform(std::move(token.value)) });
+        assert(pushed);
+        (void)pushed;
+
+        m_state->notifyProgress();
+    }
+
+protected:
+    Transform m_transform;
+    PipelineQueue<In> * m_input;
+    std::unique_ptr<PipelineQueue<Out>> m_output;
+    PipelineReorderBuffer<In> m_reorder;
+};
+
+template <typename In, typename Sink>
+class PipelineSink : public AbstractPipelineStage
+{
+public:
+    PipelineSink(std::shared_ptr<PipelineState> state, PipelineQueue<In> * input, Sink sink)
+    : AbstractPipelineStage(state, 1)
+    , m_sink(std::move(sink))
+    , m_input(input)
+    , m_reorder(state->capacity)
+    {
+    }
+
+protected:
+    virtual bool processItems()
+    {
+        PipelineToken<In> token;
+
+        while (m_input->tryPop(token))
+            m_reorder.insert(std::move(token));
+
+        auto processed = false;
+
+        while (m_reorder.takeNext(token))
+        {
+            m_sink(std::move(token.value));
+            --m_state->inFlight;
+            m_state->notifyProgress();
+
+            processed = true;
+        }
+
+        return processed;
+    }
+
+protected:
+    Sink m_sink;
+    PipelineQueue<In> * m_input;
+    PipelineReorderBuffer<In> m_reorder;
+};
+
+} // namespace util
+
+template <typename T>
+PipelineBuilder<T>::PipelineBuilder(std::shared_ptr<util::PipelineState> state, std::vector<std::unique_ptr<util::AbstractPipelineStage>> stages, util::PipelineQueue<T> * output)
+: m_state(std::move(state))
+, m_stages(std::move(stages))
+, m_output(output)
+{
+}
+
+template <typename T>
+template <typename Transform>
+PipelineBuilder<typename std::decay<decltype(std::declval<Transform &>()(std::declval<T &&>()))>::type> PipelineBuilder<T>::stage(unsigned parallelism, Transform transform)
+{
+    typedef typename std::decay<decltype(std::declval<Transform &>()(std::declval<T &&>()))>::type Out;
+
+    auto stage = new util::PipelineTransform<T, Out, Transform>(m_state, parallelism, m_output, std::move(transform));
+    m_stages.emplace_back(stage);
+
+    return PipelineBuilder<Out>(m_state, std::move(m_stages), stage->output());
+}
+
+template <typename T>
+template <typename Sink>
+Pipeline PipelineBuilder<T>::sink(Sink sink)
+{
+    m_stages.emplace_back(new util::PipelineSink<T, Sink>(m_state, m_output, std::move(sink)));
+
+    return Pipeline(m_state, std::move(m_stages));
+}
+
+template <typename T, typename Source>
+PipelineBuilder<T> Pipeline::source(Source source, std::size_t capacity)
+{
+    auto state = std::make_shared<util::PipelineState>(capacity);
+    auto stage = new util::PipelineSource<T, Source>(state, std::move(source));
+
+    std::vector<std::unique_ptr<util::AbstractPipelineStage>> stages;
+    stages.emplace_back(stage);
+
+    return PipelineBuilder<T>(state, std::move(stages), stage->output());
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/** \brief Half-open index range [begin, end) for the chunked parallel_for overloads.
+
+    \see parallel_for
+*/
+template <typename Index>
+class Range
+{
+public:
+    Range(Index begin, Index end);
+
+    Index begin() const;
+    Index end() const;
+
+    Index size() const;
+    bool empty() const;
+
+protected:
+    Index m_begin;
+    Index m_end;
+};
+
+} // namespace threadingzeug
+
+#include <threadingzeug/Range.hpp>
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <threadingzeug/Range.h>
+
+namespace threadingzeug
+{
+
+template <typename Index>
+Range<Index>::Range(Index begin, Index end)
+: m_begin(begin)
+, m_end(end)
+{
+}
+
+template <typename Index>
+Index Range<Index>::begin() const
+{
+    return m_begin;
+}
+
+template <typename Index>
+Index Range<Index>::end() const
+{
+    return m_end;
+}
+
+template <typename Index>
+Index Range<Index>::size() const
+{
+    return m_end > m_begin ? m_end - m_begin : Index(0);
+}
+
+template <typename Index>
+bool Range<Index>::empty() const
+{
+    return !(m_begin < m_end);
+}
+
+} // namespace threadingzeug
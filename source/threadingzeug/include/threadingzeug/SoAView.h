@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/Span.h>
+
+namespace threadingzeug
+{
+
+/** \brief Structure-of-arrays view: equally long arrays, one per attribute.
+
+    Instead of a vector of structs, attributes are kept in separate arrays, e.g.,
+    positions and velocities of particles. Blocks of a view keep the arrays aligned,
+    so get<I>() of a block yields the same index range in every array.
+
+    \code{.cpp}
+
+        auto particles = makeSoAView(x, y, vx, vy);
+
+        parallel_for_each(particles, [dt] (const SoAView<float, float, float, float> & block)
+        {
+            auto x = block.get<0>().data();
+            auto vx = block.get<2>().data();
+
+            for (auto i = std::size_t(0); i < block.size(); ++i)
+                x[i] += vx[i] * dt;
+            // ...
+        });
+
+    \endcode
+
+    Views of read-only arrays name const element types explicitly, e.g.,
+    SoAView<const float, float>(size, input.data(), output.data()).
+
+    \see parallel_for_each
+*/
+template <typename... T>
+class SoAView
+{
+public:
+    template <std::size_t I>
+    struct Element
+    {
+        typedef typename std::tuple_element<I, std::tuple<T...>>::type Type;
+    };
+
+public:
+    SoAView(std::size_t size, T *... data);
+
+    std::size_t size() const;
+    bool empty() const;
+
+    /**
+     * Returns the view of the I-th array.
+     */
+    template <std::size_t I>
+    Span<typename Element<I>::Type> get() const;
+
+    /**
+     * Returns the view of count elements of all arrays, starting at offset.
+     */
+    SoAView subview(std::size_t offset, std::size_t count) const;
+
+protected:
+    std::tuple<T *...> m_data;
+    std::size_t m_offset;
+    std::size_t m_size;
+};
+
+/**
+ * Creates a view of equally long vectors.
+ */
+template <typename... T>
+SoAView<T...> makeSoAView(std::vector<T> &... arrays);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/SoAView.hpp>
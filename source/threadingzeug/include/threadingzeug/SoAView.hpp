@@ -0,0 +1,60 @@
+#pragma once
+
+#include <threadingzeug/SoAView.h>
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+
+namespace threadingzeug
+{
+
+template <typename... T>
+SoAView<T...>::SoAView(std::size_t size, T *... data)
+: m_data(data...)
+, m_offset(0)
+, m_size(size)
+{
+}
+
+template <typename... T>
+std::size_t SoAView<T...>::size() const
+{
+    return m_size;
+}
+
+template <typename... T>
+bool SoAView<T...>::empty() const
+{
+    return m_size == 0;
+}
+
+template <typename... T>
+template <std::size_t I>
+Span<typename SoAView<T...>::template Element<I>::Type> SoAView<T...>::get() const
+{
+    return Span<typename Element<I>::Type>(std::get<I>(m_data) + m_offset, m_size);
+}
+
+template <typename... T>
+SoAView<T...> SoAView<T...>::subview(std::size_t offset, std::size_t count) const
+{
+    assert(offset + count <= m_size);
+
+    auto view = *this;
+    view.m_offset += offset;
+    view.m_size = count;
+
+    return view;
+}
+
+template <typename... T>
+SoAView<T...> makeSoAView(std::vector<T> &... arrays)
+{
+    const auto sizes = { arrays.size()... };
+    assert(std::min(sizes) == std::max(sizes));
+
+    return SoAView<T...>(*sizes.begin(), arrays.data()...);
+}
+
+} // namespace threadingzeug
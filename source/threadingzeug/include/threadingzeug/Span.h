@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/** \brief Non-owning view of a contiguous array.
+
+    parallel_for_each passes each block of an array as a Span, so that the
+    callback can process it in a plain loop over a pointer range, which
+    compilers can vectorize.
+
+    \see parallel_for_each
+    \see SoAView
+*/
+template <typename T>
+class Span
+{
+public:
+    typedef T ValueType;
+    typedef T * Iterator;
+
+public:
+    Span();
+    Span(T * data, std::size_t size);
+
+    template <typename U>
+    Span(std::vector<U> & values);
+    template <typename U>
+    Span(const std::vector<U> & values);
+
+    T * data() const;
+    std::size_t size() const;
+    bool empty() const;
+
+    T * begin() const;
+    T * end() const;
+
+    T & operator[](std::size_t index) const;
+
+    /**
+     * Returns the view of count values starting at offset.
+     */
+    Span subspan(std::size_t offset, std::size_t count) const;
+
+protected:
+    T * m_data;
+    std::size_t m_size;
+};
+
+} // namespace threadingzeug
+
+#include <threadingzeug/Span.hpp>
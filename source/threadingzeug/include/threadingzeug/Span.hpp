@@ -0,0 +1,84 @@
+#pragma once
+
+#include <threadingzeug/Span.h>
+
+#include <cassert>
+
+namespace threadingzeug
+{
+
+template <typename T>
+Span<T>::Span()
+: m_data(nullptr)
+, m_size(0)
+{
+}
+
+template <typename T>
+Span<T>::Span(T * data, std::size_t size)
+: m_data(data)
+, m_size(size)
+{
+}
+
+template <typename T>
+template <typename U>
+Span<T>::Span(std::vector<U> & values)
+: m_data(values.data())
+, m_size(values.size())
+{
+}
+
+template <typename T>
+template <typename U>
+Span<T>::Span(const std::vector<U> & values)
+: m_data(values.data())
+, m_size(values.size())
+{
+}
+
+template <typename T>
+T * Span<T>::data() const
+{
+    return m_data;
+}
+
+template <typename T>
+std::size_t Span<T>::size() const
+{
+    return m_size;
+}
+
+template <typename T>
+bool Span<T>::empty() const
+{
+    return m_size == 0;
+}
+
+template <typename T>
+T * Span<T>::begin() const
+{
+    return m_data;
+}
+
+template <typename T>
+T * Span<T>::end() const
+{
+    return m_data + m_size;
+}
+
+template <typename T>
+T & Span<T>::operator[](std::size_t index) const
+{
+    assert(index < m_size);
+    return m_data[index];
+}
+
+template <typename T>
+Span<T> Span<T>::subspan(std::size_t offset, std::size_t count) const
+{
+    assert(offset + count <= m_size);
+    return Span<T>(m_data + offset, count);
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/Future.h>
+
+namespace threadingzeug
+{
+
+/** \brief Directed acyclic graph of tasks, executed on the ThreadPool as dependencies finish.
+
+    A node can only depend on nodes added before it, so every graph is acyclic by
+    construction. A graph can be launched repeatedly; launches must not overlap.
+
+    \code{.cpp}
+
+        TaskGraph graph;
+
+        auto load = graph.add([&] () { source = iozeug::readFile(path); });
+        auto parse = graph.add([&] () { deserializer.fromString(source); }, { load });
+        auto prepare = graph.add([&] () { prepareGeometry(); });
+        graph.add([&] () { compute(); }, { parse, prepare });
+
+        graph.run();
+
+    \endcode
+
+    If a task throws, tasks that have not started yet are skipped and the first
+    exception is rethrown by run() or stored in the future returned by launch().
+
+    \see spawn
+    \see Future
+*/
+class THREADINGZEUG_API TaskGraph
+{
+public:
+    typedef std::size_t Node;
+    typedef std::function<void()> Task;
+
+public:
+    TaskGraph();
+
+    /**
+     * Adds a task that runs after all dependencies have finished.
+     * \return Handle to refer to the task in dependencies of later tasks
+     */
+    Node add(Task task, const std::vector<Node> & dependencies = std::vector<Node>());
+
+    std::size_t size() const;
+
+    /**
+     * Starts all tasks without dependencies and returns a future that becomes ready once every task has finished.
+     */
+    Future<void> launch() const;
+
+    /**
+     * Launches the graph and waits for it.
+     */
+    void run() const;
+
+protected:
+    struct NodeData
+    {
+        Task task;
+        std::vector<Node> successors;
+        std::size_t numberOfDependencies;
+    };
+
+protected:
+    std::vector<NodeData> m_nodes;
+};
+
+} // namespace threadingzeug
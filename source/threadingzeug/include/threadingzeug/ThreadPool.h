@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/** \brief How ThreadPool::configure() pins workers to the CPUs of the NUMA nodes.
+
+    - Unpinned: workers may run on any CPU
+    - Compact: workers fill the CPUs of one node before using the next node
+    - Spread: workers are distributed evenly across the nodes
+
+    In both pinned placements, the workers of one node have consecutive indices,
+    so consecutive blocks of a SchedulingPolicy::Pinned loop stay on one node.
+
+    \see numaNodes
+*/
+enum class Placement : char { Unpinned, Compact, Spread };
+
+/** \brief Persistent pool of worker threads with work-stealing scheduling.
+
+    Every worker owns a task deque. A worker pops tasks from the back of its own
+    deque and, once it runs dry, steals from the front of the other workers' deques.
+    Idle workers sleep until new tasks are submitted.
+
+    The process-wide pool returned by instance() is created on first use and
+    reused by parallel_for, so a loop does not pay for thread creation.
+    Its thread count and CPU affinity can be set with configure().
+
+    \code{.cpp}
+
+        ThreadPool::configure(4, { 0, 2, 4, 6 });
+
+        ThreadPool::instance().execute(8, [] (unsigned job)
+        {
+            // ...
+        });
+
+    \endcode
+
+    \see parallel_for
+*/
+class THREADINGZEUG_API ThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+    typedef std::function<void(unsigned job)> Job;
+
+    /** \brief Returns the process-wide pool, creating it on first use.
+    */
+    static ThreadPool & instance();
+
+    /** \brief Replaces the process-wide pool by one with the given configuration.
+
+        Must not be called while tasks are running on the current pool.
+
+        \param numberOfThreads
+            Number of worker threads; 0 selects hardware concurrency minus one,
+            since the thread calling execute() takes part in the work as well.
+        \param affinity
+            Logical CPU indices the workers are pinned to (worker i uses
+            affinity[i % affinity.size()]); empty leaves placement to the OS.
+    */
+    static void configure(unsigned numberOfThreads, const std::vector<int> & affinity = std::vector<int>());
+
+    /** \brief Replaces the process-wide pool by one with workers pinned according to placement.
+    */
+    static void configure(unsigned numberOfThreads, Placement placement);
+
+    /** \brief Returns the CPUs numberOfThreads workers are pinned to with the given placement.
+
+        Workers get one CPU each as long as there are enough; with more workers than CPUs, CPUs are reused.
+    */
+    static std::vector<int> affinityFor(unsigned numberOfThreads, Placement placement);
+
+public:
+    explicit ThreadPool(unsigned numberOfThreads = 0, const std::vector<int> & affinity = std::vector<int>());
+    ~ThreadPool();
+
+    unsigned numberOfThreads() const;
+
+    /** \brief Returns the index of the calling worker or -1 if the calling thread is not a worker of this pool.
+    */
+    int currentWorker() const;
+
+    /** \brief Returns the NUMA node the worker is pinned to or -1 if it is not pinned.
+    */
+    int numaNode(unsigned worker) const;
+
+    /** \brief Queues a task.
+
+        Tasks submitted from a worker go to that worker's own deque,
+        tasks from other threads are distributed round-robin.
+    */
+    void submit(Task task);
+
+    /** \brief Queues a task that is run by the given worker only; other workers never steal it.
+    */
+    void submitTo(unsigned worker, Task task);
+
+    /** \brief Runs job(0) ... job(numberOfJobs - 1) concurrently and returns when all jobs have finished.
+
+        The calling thread works on the jobs as well, which makes nested calls
+        from within a worker safe: jobs no other worker picks up are run by the caller.
+        While a worker waits for jobs still running elsewhere, it runs other pending
+        tasks, so nested loops share the existing workers and never create threads.
+
+        If a job throws, jobs not yet started are skipped and the first exception
+        is rethrown once the jobs already running have finished.
+    */
+    void execute(unsigned numberOfJobs, const Job & job);
+
+    /** \brief Runs job(i) on worker i for every worker and returns when all jobs have finished.
+
+        Unlike execute(), the mapping of jobs to threads is fixed: repeated calls run each
+        job index on the same worker and, if the workers are pinned, on the same CPU.
+        Exceptions are handled as in execute().
+    */
+    void executePinned(const Job & job);
+
+    /** \brief Runs one queued task on the calling thread, if there is any.
+
+        Workers prefer their own deque; other threads take tasks from any worker.
+        Threads waiting for a result call this to help instead of blocking.
+
+        \return true if a task was run
+    */
+    bool runPendingTask();
+
+    /** \brief Lets the calling worker run queued tasks until isDone() returns true.
+
+        While there are no tasks, the worker sleeps until one is queued or
+        wakeBlockedWorkers() is called. Whoever makes isDone() true therefore has to call
+        wakeBlockedWorkers() afterwards.
+    */
+    void helpUntil(const std::function<bool()> & isDone);
+
+    /** \brief Wakes the workers sleeping in helpUntil() to check their condition again.
+    */
+    void wakeBlockedWorkers();
+
+protected:
+    struct Worker;
+
+    void run(unsigned index);
+
+    bool popPinned(unsigned index, Task & task);
+    bool pop(unsigned index, Task & task);
+    bool steal(unsigned index, Task & task);
+
+protected:
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<int> m_affinity;
+
+    std::atomic<unsigned> m_pending;
+    std::atomic<unsigned> m_nextWorker;
+    std::atomic<bool> m_stop;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    // workers in helpUntil() wait on this, guarded by m_mutex
+    std::condition_variable m_workAvailable;
+    unsigned m_blocked;
+};
+
+} // namespace threadingzeug
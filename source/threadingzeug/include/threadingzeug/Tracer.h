@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/parallelfor.h>
+
+namespace threadingzeug
+{
+
+/**
+ * Scheduler counters of one thread, accumulated while recording.
+ */
+struct ThreadCounters
+{
+    /** Index of the ThreadPool worker or -1 for other threads, e.g., the main thread */
+    int worker;
+
+    std::uint64_t busyNanoseconds;
+    std::uint64_t idleNanoseconds;
+    std::uint64_t tasks;
+    std::uint64_t steals;
+
+    std::uint64_t chunks;
+    std::uint64_t chunkIndices;
+    std::uint64_t minChunkSize;
+    std::uint64_t maxChunkSize;
+};
+
+/**
+ * A chunked parallel_for call, recorded on the calling thread.
+ */
+struct LoopRecord
+{
+    std::int64_t size;
+    std::int64_t grain;
+    SchedulingPolicy policy;
+
+    std::uint64_t wallNanoseconds;
+};
+
+/** \brief Records what the ThreadPool and parallel_for spend their time on.
+
+    Instrumentation is compiled in with OPTION_THREADINGZEUG_TRACING only
+    (see available()); otherwise the scheduler contains no instrumentation at all,
+    and recording yields empty counters and traces.
+
+    While recording, every thread keeps its own counters and events, so threads
+    do not contend for them. Workers are busy while running tasks and idle
+    while sleeping for new ones. The trace can be loaded into chrome://tracing
+    or any viewer of the Chrome trace event format.
+
+    \code{.cpp}
+
+        Tracer::start();
+        simulate();
+        Tracer::stop();
+
+        Tracer::writeChromeTrace("simulation.json");
+
+    \endcode
+
+    Reading counters or writing traces while loops are running is safe,
+    but yields a snapshot of unfinished work.
+*/
+class THREADINGZEUG_API Tracer
+{
+public:
+    /**
+     * Returns whether instrumentation is compiled in.
+     */
+    static bool available();
+
+    /**
+     * Discards previous recordings and starts recording.
+     */
+    static void start();
+    static void stop();
+    static bool recording();
+
+    /**
+     * Returns the counters of all threads that took part in scheduling since start().
+     */
+    static std::vector<ThreadCounters> counters();
+    static std::vector<LoopRecord> loops();
+
+    static void writeChromeTrace(std::ostream & stream);
+    static bool writeChromeTrace(const std::string & fileName);
+};
+
+} // namespace threadingzeug
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/Range.h>
+
+namespace threadingzeug
+{
+
+/**
+ * Returns the smallest index in range satisfying the predicate, or range.end() if there is none
+ * (like std::find_if). Blocks are claimed in ascending order and the search stops claiming blocks
+ * once a match is found, so indices after the first match are mostly not evaluated.
+ *
+ * \code{.cpp}
+ * const auto hit = parallel_find_if(Range<std::size_t>(0, rays.size()), [&] (std::size_t i) { return intersects(rays[i], box); });
+ * \endcode
+ */
+template <typename Index, typename Predicate>
+typename std::enable_if<std::is_integral<Index>::value, Index>::type parallel_find_if(const Range<Index> & range, Predicate && predicate);
+
+/**
+ * Returns an iterator to the first value satisfying the predicate, or values.end() if there is none.
+ */
+template <typename T, typename Predicate>
+typename std::vector<T>::const_iterator parallel_find_if(const std::vector<T> & values, Predicate && predicate);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/parallelfind.hpp>
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <threadingzeug/parallelfind.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include <threadingzeug/CancellationToken.h>
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
+
+namespace threadingzeug
+{
+
+template <typename Index, typename Predicate>
+typename std::enable_if<std::is_integral<Index>::value, Index>::type parallel_find_if(const Range<Index> & range, Predicate && predicate)
+{
+    if (range.empty())
+        return range.end();
+
+    // small blocks, so that the search does not run far past the first match
+    const auto size = static_cast<std::int64_t>(range.size());
+    const std::int64_t participants = ThreadPool::instance().numberOfThreads() + 1;
+    const auto grain = std::max(std::int64_t(256), size / (64 * participants));
+
+    std::atomic<std::int64_t> found(range.end());
+    CancellationToken token;
+
+    parallel_for(Range<std::int64_t>(range.begin(), range.end()), grain, [&] (std::int64_t first, std::int64_t last)
+    {
+        for (auto i = first; i < last && i < found.load(std::memory_order_relaxed); ++i)
+        {
+            if (!predicate(static_cast<Index>(i)))
+                continue;
+
+            auto current = found.load();
+            while (i < current && !found.compare_exchange_weak(current, i));
+
+            // blocks are claimed in ascending order, so all unclaimed blocks lie behind the match
+            token.cancel();
+            return;
+        }
+    }, SchedulingPolicy::Dynamic, token);
+
+    return static_cast<Index>(found.load());
+}
+
+template <typename T, typename Predicate>
+typename std::vector<T>::const_iterator parallel_find_if(const std::vector<T> & values, Predicate && predicate)
+{
+    const auto index = parallel_find_if(Range<std::size_t>(0, values.size()), [&values, &predicate] (std::size_t i)
+    {
+        return predicate(values[i]);
+    });
+
+    return values.begin() + index;
+}
+
+} // namespace threadingzeug
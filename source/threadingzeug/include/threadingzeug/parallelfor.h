@@ -1,13 +1,31 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <type_traits>
 #include <vector>
 
 #include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/CancellationToken.h>
+#include <threadingzeug/Range.h>
 
 namespace threadingzeug
 {
 
+/** \brief How the chunked parallel_for hands out contiguous blocks of a Range.
+
+    - Static: one block of about range.size() / threads indices per thread
+    - Dynamic: blocks of grain indices, taken by whichever thread is idle
+    - Guided: blocks shrinking from range.size() / (2 * threads) down to grain indices
+    - Pinned: one block per worker, block i always run by worker i (the grain is ignored)
+
+    Pinned suits data that is initialised by one loop and processed by later loops over
+    the same range: with workers pinned by ThreadPool::configure(), every index is touched
+    from the same CPU in each loop, so memory placed on a NUMA node by the first touch
+    is read from that node later on. The calling thread only waits.
+*/
+enum class SchedulingPolicy : char { Static, Dynamic, Guided, Pinned };
+
 template<typename T>
 void parallel_for(const std::vector<T>& elements, std::function<void(const T& element)> callback);
 
@@ -16,6 +34,59 @@ void parallel_for(std::vector<T>& elements, std::function<void(T& element)> call
 
 THREADINGZEUG_API void parallel_for(int start, int end, std::function<void(int i)> callback);
 
+/**
+ * Calls callback(begin, end) concurrently for contiguous, disjoint blocks covering the range.
+ * No block is smaller than grain, except for the last one.
+ *
+ * \code{.cpp}
+ * parallel_for(Range<int>(0, size), 4096, [&] (int begin, int end)
+ * {
+ *     for (auto i = begin; i < end; ++i)
+ *         output[i] = input[i] * 2.0f;
+ * }, SchedulingPolicy::Dynamic);
+ * \endcode
+ */
+THREADINGZEUG_API void parallel_for(const Range<int> & range, int grain, std::function<void(int begin, int end)> callback, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+/**
+ * 64 bit variant of the chunked parallel_for that all other overloads are scheduled by.
+ *
+ * If a callback throws, no further blocks are started and the first exception
+ * is rethrown on the calling thread once the running blocks have finished.
+ */
+THREADINGZEUG_API void parallel_for(const Range<std::int64_t> & range, std::int64_t grain, std::function<void(std::int64_t begin, std::int64_t end)> callback, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+/**
+ * Cancellable variant: no further blocks are started once the token is cancelled.
+ *
+ * \see CancellationToken
+ */
+THREADINGZEUG_API void parallel_for(const Range<std::int64_t> & range, std::int64_t grain, std::function<void(std::int64_t begin, std::int64_t end)> callback, SchedulingPolicy policy, const CancellationToken & token);
+
+/**
+ * Header-only variant for any integral index type (e.g., std::size_t for element counts beyond 2^31).
+ * The callback is invoked per index from an inner loop of each block and can thus be inlined
+ * and vectorized by the compiler; only one indirect call per block remains.
+ *
+ * \code{.cpp}
+ * parallel_for(std::size_t(0), values.size(), [&values] (std::size_t i)
+ * {
+ *     values[i] *= 2.0f;
+ * });
+ * \endcode
+ */
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type parallel_for(Index start, Index end, Callback && callback);
+
+/**
+ * Header-only variant of the chunked parallel_for for any integral index type.
+ */
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type parallel_for(const Range<Index> & range, Index grain, Callback && callback, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type parallel_for(const Range<Index> & range, Index grain, Callback && callback, SchedulingPolicy policy, const CancellationToken & token);
+
 
 template<typename T>
 void sequential_for(const std::vector<T>& elements, std::function<void(const T& element)> callback);
@@ -25,6 +96,9 @@ void sequential_for(std::vector<T>& elements, std::function<void(T& element)> ca
 
 THREADINGZEUG_API void sequential_for(int start, int end, std::function<void(int i)> callback);
 
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type sequential_for(Index start, Index end, Callback && callback);
+
 } // namespace threadingzeug
 
 #include <threadingzeug/parallelfor.hpp>
@@ -8,7 +8,7 @@ namespace threadingzeug
 template<typename T>
 void parallel_for(const std::vector<T>& elements, std::function<void(const T& element)> callback)
 {
-	parallel_for(0, elements.size(), [callback, &elements](unsigned i) {
+	parallel_for(std::size_t(0), elements.size(), [&callback, &elements](std::size_t i) {
 		callback(elements[i]);
 	});
 }
@@ -16,16 +16,51 @@ void parallel_for(const std::vector<T>& elements, std::function<void(const T& el
 template<typename T>
 void parallel_for(std::vector<T>& elements, std::function<void(T& element)> callback)
 {
-	parallel_for(0, elements.size(), [callback, &elements](unsigned i) {
+	parallel_for(std::size_t(0), elements.size(), [&callback, &elements](std::size_t i) {
 		callback(elements[i]);
 	});
 }
 
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type parallel_for(Index start, Index end, Callback && callback)
+{
+	parallel_for(Range<Index>(start, end), Index(1), [&callback](Index begin, Index end) {
+		for (auto i = begin; i < end; ++i)
+			callback(i);
+	});
+}
+
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type parallel_for(const Range<Index> & range, Index grain, Callback && callback, SchedulingPolicy policy)
+{
+	if (range.empty())
+		return;
+
+	const std::function<void(std::int64_t, std::int64_t)> block = [&callback](std::int64_t begin, std::int64_t end) {
+		callback(static_cast<Index>(begin), static_cast<Index>(end));
+	};
+
+	parallel_for(Range<std::int64_t>(range.begin(), range.end()), static_cast<std::int64_t>(grain), block, policy);
+}
+
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type parallel_for(const Range<Index> & range, Index grain, Callback && callback, SchedulingPolicy policy, const CancellationToken & token)
+{
+	if (range.empty())
+		return;
+
+	const std::function<void(std::int64_t, std::int64_t)> block = [&callback](std::int64_t begin, std::int64_t end) {
+		callback(static_cast<Index>(begin), static_cast<Index>(end));
+	};
+
+	parallel_for(Range<std::int64_t>(range.begin(), range.end()), static_cast<std::int64_t>(grain), block, policy, token);
+}
+
 
 template<typename T>
 void sequential_for(const std::vector<T>& elements, std::function<void(const T& element)> callback)
 {
-	sequential_for(0, elements.size(), [callback, &elements](unsigned i) {
+	sequential_for(std::size_t(0), elements.size(), [&callback, &elements](std::size_t i) {
 		callback(elements[i]);
 	});
 }
@@ -33,9 +68,16 @@ void sequential_for(const std::vector<T>& elements, std::function<void(const T&
 template<typename T>
 void sequential_for(std::vector<T>& elements, std::function<void(T& element)> callback)
 {
-	sequential_for(0, elements.size(), [callback, &elements](unsigned i) {
+	sequential_for(std::size_t(0), elements.size(), [&callback, &elements](std::size_t i) {
 		callback(elements[i]);
 	});
 }
 
+template <typename Index, typename Callback>
+typename std::enable_if<std::is_integral<Index>::value>::type sequential_for(Index start, Index end, Callback && callback)
+{
+	for (auto i = start; i < end; ++i)
+		callback(i);
+}
+
 } // namespace threadingzeug
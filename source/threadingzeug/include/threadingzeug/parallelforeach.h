@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/SoAView.h>
+#include <threadingzeug/Span.h>
+
+namespace threadingzeug
+{
+
+/**
+ * Block boundaries of parallel_for_each are multiples of this many elements,
+ * so that blocks start at the same alignment as the array and, for elements of
+ * up to four bytes, do not share cache lines.
+ */
+const std::size_t s_forEachAlignment = 16;
+
+/**
+ * Default minimum number of elements per block of parallel_for_each.
+ */
+const std::size_t s_forEachGrain = 4096;
+
+/**
+ * Calls callback(Span<T> block) concurrently for contiguous, disjoint blocks covering all values.
+ *
+ * Unlike the per-element parallel_for over vectors, the callback processes a whole
+ * block in its own loop, which the compiler can vectorize:
+ *
+ * \code{.cpp}
+ * parallel_for_each(Span<float>(values), [factor] (Span<float> block)
+ * {
+ *     for (auto & value : block)
+ *         value *= factor;
+ * });
+ * \endcode
+ */
+template <typename T, typename Callback>
+void parallel_for_each(Span<T> values, Callback && callback, std::size_t grain = s_forEachGrain, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+template <typename T, typename Callback>
+void parallel_for_each(std::vector<T> & values, Callback && callback, std::size_t grain = s_forEachGrain, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+template <typename T, typename Callback>
+void parallel_for_each(const std::vector<T> & values, Callback && callback, std::size_t grain = s_forEachGrain, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+/**
+ * Calls callback(SoAView<T...> block) concurrently for contiguous, disjoint blocks covering the view.
+ */
+template <typename Callback, typename... T>
+void parallel_for_each(const SoAView<T...> & view, Callback && callback, std::size_t grain = s_forEachGrain, SchedulingPolicy policy = SchedulingPolicy::Static);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/parallelforeach.hpp>
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <threadingzeug/parallelforeach.h>
+
+#include <algorithm>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+/**
+ * Calls block(begin, end) for blocks of size elements whose boundaries are multiples of s_forEachAlignment.
+ */
+template <typename Block>
+void forEachAligned(std::size_t size, std::size_t grain, SchedulingPolicy policy, Block & block)
+{
+    if (size == 0)
+        return;
+
+    const auto lanes = (size + s_forEachAlignment - 1) / s_forEachAlignment;
+    const auto lanesPerGrain = std::max(std::size_t(1), (grain + s_forEachAlignment - 1) / s_forEachAlignment);
+
+    parallel_for(Range<std::size_t>(0, lanes), lanesPerGrain, [size, &block] (std::size_t first, std::size_t last)
+    {
+        const auto begin = first * s_forEachAlignment;
+        const auto end = std::min(size, last * s_forEachAlignment);
+
+        block(begin, end);
+    }, policy);
+}
+
+} // namespace util
+
+template <typename T, typename Callback>
+void parallel_for_each(Span<T> values, Callback && callback, std::size_t grain, SchedulingPolicy policy)
+{
+    auto block = [&values, &callback] (std::size_t begin, std::size_t end)
+    {
+        callback(values.subspan(begin, end - begin));
+    };
+
+    util::forEachAligned(values.size(), grain, policy, block);
+}
+
+template <typename T, typename Callback>
+void parallel_for_each(std::vector<T> & values, Callback && callback, std::size_t grain, SchedulingPolicy policy)
+{
+    parallel_for_each(Span<T>(values), callback, grain, policy);
+}
+
+template <typename T, typename Callback>
+void parallel_for_each(const std::vector<T> & values, Callback && callback, std::size_t grain, SchedulingPolicy policy)
+{
+    parallel_for_each(Span<const T>(values), callback, grain, policy);
+}
+
+template <typename Callback, typename... T>
+void parallel_for_each(const SoAView<T...> & view, Callback && callback, std::size_t grain, SchedulingPolicy policy)
+{
+    auto block = [&view, &callback] (std::size_t begin, std::size_t end)
+    {
+        callback(view.subview(begin, end - begin));
+    };
+
+    util::forEachAligned(view.size(), grain, policy, block);
+}
+
+} // namespace threadingzeug
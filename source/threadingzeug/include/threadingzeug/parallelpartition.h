@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/**
+ * Reorders the values so that all values satisfying the predicate precede all others,
+ * keeping the relative order within both groups (like std::stable_partition).
+ * The predicate is evaluated exactly once per value.
+ *
+ * \return Index of the first value not satisfying the predicate
+ */
+template <typename T, typename Predicate>
+std::size_t parallel_partition(std::vector<T> & values, Predicate && predicate);
+
+/**
+ * Stream compaction: replaces output by all input values satisfying the predicate, in input order.
+ * The predicate is evaluated exactly once per value.
+ *
+ * \code{.cpp}
+ * parallel_copy_if(particles, alive, [] (const Particle & particle) { return particle.lifetime > 0.0f; });
+ * \endcode
+ */
+template <typename T, typename Predicate>
+void parallel_copy_if(const std::vector<T> & input, std::vector<T> & output, Predicate && predicate);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/parallelpartition.hpp>
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <threadingzeug/parallelpartition.h>
+
+#include <utility>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/util.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+/**
+ * Evaluates the predicate once per input value and computes, per block of the input,
+ * the number of selected values preceding the block.
+ * Returns the total number of selected values.
+ */
+template <typename T, typename Predicate>
+std::size_t selectBlocks(const std::vector<T> & input, Predicate & predicate, std::vector<unsigned char> & selected, std::vector<std::size_t> & offsets)
+{
+    const auto size = input.size();
+    const auto blocks = offsets.size() - 1;
+
+    selected.resize(size);
+
+    parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+    {
+        for (auto block = first; block < last; ++block)
+        {
+            auto count = std::size_t(0);
+
+            const auto end = blockBegin(size, blocks, block + 1);
+            for (auto i = blockBegin(size, blocks, block); i < end; ++i)
+            {
+                selected[i] = predicate(input[i]) ? 1 : 0;
+                count += selected[i];
+            }
+
+            offsets[block + 1] = count;
+        }
+    }, SchedulingPolicy::Dynamic);
+
+    offsets[0] = 0;
+    for (auto block = std::size_t(1); block <= blocks; ++block)
+        offsets[block] += offsets[block - 1];
+
+    return offsets[blocks];
+}
+
+} // namespace util
+
+template <typename T, typename Predicate>
+std::size_t parallel_partition(std::vector<T> & values, Predicate && predicate)
+{
+    const auto size = values.size();
+    const auto blocks = util::numberOfBlocks(size, 4096);
+
+    auto selected = std::vector<unsigned char>();
+    auto offsets = std::vector<std::size_t>(blocks + 1);
+
+    const auto total = util::selectBlocks(values, predicate, selected, offsets);
+
+    if (total == 0 || total == size)
+        return total;
+
+    auto buffer = std::vector<T>(values);
+
+    parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+    {
+        for (auto block = first; block < last; ++block)
+        {
+            const auto begin = util::blockBegin(size, blocks, block);
+            const auto end = util::blockBegin(size, blocks, block + 1);
+
+            // rejected values are placed after all selected ones, preceded by the rejected values of previous blocks
+            auto selectedIndex = offsets[block];
+            auto rejectedIndex = total + begin - offsets[block];
+
+            for (auto i = begin; i < end; ++i)
+            {
+                if (selected[i])
+                    buffer[selectedIndex++] = std::move(values[i]);
+                else
+                    buffer[rejectedIndex++] = std::move(values[i]);
+            }
+        }
+    }, SchedulingPolicy::Dynamic);
+
+    values.swap(buffer);
+    return total;
+}
+
+template <typename T, typename Predicate>
+void parallel_copy_if(const std::vector<T> & input, std::vector<T> & output, Predicate && predicate)
+{
+    const auto size = input.size();
+    const auto blocks = util::numberOfBlocks(size, 4096);
+
+    auto selected = std::vector<unsigned char>();
+    auto offsets = std::vector<std::size_t>(blocks + 1);
+
+    const auto total = util::selectBlocks(input, predicate, selected, offsets);
+
+    output.clear();
+
+    if (total == 0)
+        return;
+
+    output.resize(total, input.front());
+
+    parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+    {
+        for (auto block = first; block < last; ++block)
+        {
+            auto index = offsets[block];
+
+            const auto end = util::blockBegin(size, blocks, block + 1);
+            for (auto i = util::blockBegin(size, blocks, block); i < end; ++i)
+            {
+                if (selected[i])
+                    output[index++] = input[i];
+            }
+        }
+    }, SchedulingPolicy::Dynamic);
+}
+
+} // namespace threadingzeug
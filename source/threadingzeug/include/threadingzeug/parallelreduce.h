@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+#include <threadingzeug/Range.h>
+
+namespace threadingzeug
+{
+
+/** \brief Order in which parallel_reduce combines partial results.
+
+    - Unordered: the range is split into a few blocks per thread, so the grouping
+      of elements depends on the number of threads (for associative and exact operations)
+    - Deterministic: the range is split into blocks that depend on its size only
+      and their results are combined in a fixed tree, so floating-point results
+      are reproducible independent of the number of threads
+*/
+enum class ReductionOrder : char { Unordered, Deterministic };
+
+/** \brief Wraps a value with enough padding to keep neighboring values on separate cache lines.
+*/
+template <typename T>
+struct CacheLinePadded
+{
+    static const std::size_t s_cacheLineSize = 64;
+
+    T value;
+    char padding[s_cacheLineSize];
+};
+
+/**
+ * Reduces map(i) for all indices of the range using the associative combine operation.
+ * Each block of the range is accumulated into its own cache line padded partial result;
+ * the partial results are combined in a tree on the calling thread.
+ *
+ * \code{.cpp}
+ * auto sum = parallel_reduce(Range<std::size_t>(0, values.size()), 0.0,
+ *     [&values] (std::size_t i) { return values[i]; },
+ *     [] (double a, double b) { return a + b; });
+ * \endcode
+ *
+ * \param identity
+ *     Neutral element of combine; also the result for an empty range
+ */
+template <typename Index, typename T, typename Map, typename Combine>
+T parallel_reduce(const Range<Index> & range, const T & identity, Map && map, Combine && combine, ReductionOrder order = ReductionOrder::Unordered);
+
+/**
+ * Reduces transform(element) for all elements using the associative combine operation.
+ *
+ * \see parallel_reduce
+ */
+template <typename E, typename T, typename Transform, typename Combine>
+T parallel_transform_reduce(const std::vector<E> & elements, const T & identity, Transform && transform, Combine && combine, ReductionOrder order = ReductionOrder::Unordered);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/parallelreduce.hpp>
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <threadingzeug/parallelreduce.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
+#include <threadingzeug/util.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+// reduces blocks of grain indices into one partial result each, written by the task reducing the block only
+template <typename Index, typename T, typename Map, typename Combine>
+T reduceBlocks(const Range<Index> & range, std::int64_t grain, const T & identity, Map && map, Combine && combine)
+{
+    const auto size = static_cast<std::int64_t>(range.size());
+    const auto numberOfBlocks = static_cast<std::size_t>((size + grain - 1) / grain);
+
+    auto partials = std::vector<CacheLinePadded<T>>(numberOfBlocks, CacheLinePadded<T>{ identity, {} });
+
+    parallel_for(Range<std::int64_t>(0, numberOfBlocks), std::int64_t(1), [&] (std::int64_t first, std::int64_t last)
+    {
+        for (auto block = first; block < last; ++block)
+        {
+            const auto begin = range.begin() + static_cast<Index>(block * grain);
+            const auto end = block + 1 == static_cast<std::int64_t>(numberOfBlocks) ? range.end() : begin + static_cast<Index>(grain);
+
+            auto accumulator = identity;
+            for (auto i = begin; i < end; ++i)
+                accumulator = combine(accumulator, map(i));
+
+            partials[static_cast<std::size_t>(block)].value = accumulator;
+        }
+    }, SchedulingPolicy::Dynamic);
+
+    combineTree(partials, &CacheLinePadded<T>::value, combine);
+    return partials.front().value;
+}
+
+} // namespace util
+
+template <typename Index, typename T, typename Map, typename Combine>
+T parallel_reduce(const Range<Index> & range, const T & identity, Map && map, Combine && combine, ReductionOrder order)
+{
+    if (range.empty())
+        return identity;
+
+    const auto size = static_cast<std::int64_t>(range.size());
+
+    if (order == ReductionOrder::Deterministic)
+    {
+        // the blocking depends on the size of the range only, never on the number of threads
+        const std::int64_t maxBlocks = 4096;
+        const auto grain = std::max(std::int64_t(1024), (size + maxBlocks - 1) / maxBlocks);
+
+        return util::reduceBlocks(range, grain, identity, map, combine);
+    }
+
+    // a few blocks per thread; results are per block rather than per thread, since
+    // threads outside the pool may help run blocks while waiting
+    const auto numberOfThreads = static_cast<std::int64_t>(ThreadPool::instance().numberOfThreads()) + 1;
+    const auto grain = std::max(std::int64_t(1), size / (8 * numberOfThreads));
+
+    return util::reduceBlocks(range, grain, identity, map, combine);
+}
+
+template <typename E, typename T, typename Transform, typename Combine>
+T parallel_transform_reduce(const std::vector<E> & elements, const T & identity, Transform && transform, Combine && combine, ReductionOrder order)
+{
+    return parallel_reduce(Range<std::size_t>(0, elements.size()), identity, [&elements, &transform] (std::size_t i)
+    {
+        return transform(elements[i]);
+    }, combine, order);
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/**
+ * Writes output[i] = input[0] + ... + input[i] (using combine instead of +).
+ * Input and output may be the same vector.
+ *
+ * The input is split into one block per thread: block sums are computed concurrently,
+ * scanned on the calling thread, and then used as offsets while the blocks are
+ * scanned concurrently. combine has to be associative.
+ *
+ * \code{.cpp}
+ * parallel_inclusive_scan(counts, offsets, [] (int a, int b) { return a + b; });
+ * \endcode
+ */
+template <typename T, typename Combine>
+void parallel_inclusive_scan(const std::vector<T> & input, std::vector<T> & output, Combine && combine);
+
+template <typename T>
+void parallel_inclusive_scan(const std::vector<T> & input, std::vector<T> & output);
+
+/**
+ * Writes output[i] = identity + input[0] + ... + input[i - 1] (using combine instead of +).
+ * Input and output may be the same vector.
+ *
+ * \see parallel_inclusive_scan
+ */
+template <typename T, typename Combine>
+void parallel_exclusive_scan(const std::vector<T> & input, std::vector<T> & output, const T & identity, Combine && combine);
+
+template <typename T>
+void parallel_exclusive_scan(const std::vector<T> & input, std::vector<T> & output, const T & identity = T());
+
+} // namespace threadingzeug
+
+#include <threadingzeug/parallelscan.hpp>
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <threadingzeug/parallelscan.h>
+
+#include <cstddef>
+#include <functional>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/util.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+template <typename T, typename Combine>
+void parallelScan(const std::vector<T> & input, std::vector<T> & output, const T * identity, Combine && combine)
+{
+    const auto size = input.size();
+    output.resize(size);
+
+    if (size == 0)
+        return;
+
+    const auto blocks = numberOfBlocks(size, 4096);
+
+    // offsets[b] combines all elements before block b, offsets[0] is unused
+    auto offsets = std::vector<T>(blocks, input.front());
+
+    if (blocks > 1)
+    {
+        parallel_for(Range<std::size_t>(0, blocks - 1), std::size_t(1), [&] (std::size_t first, std::size_t last)
+        {
+            for (auto block = first; block < last; ++block)
+            {
+                const auto begin = blockBegin(size, blocks, block);
+                const auto end = blockBegin(size, blocks, block + 1);
+
+                auto sum = input[begin];
+                for (auto i = begin + 1; i < end; ++i)
+                    sum = combine(sum, input[i]);
+
+                offsets[block + 1] = sum;
+            }
+        }, SchedulingPolicy::Dynamic);
+
+        for (auto block = std::size_t(2); block < blocks; ++block)
+            offsets[block] = combine(offsets[block - 1], offsets[block]);
+    }
+
+    parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+    {
+        for (auto block = first; block < last; ++block)
+        {
+            const auto begin = blockBegin(size, blocks, block);
+            const auto end = blockBegin(size, blocks, block + 1);
+
+            if (identity)
+            {
+                T sum = block > 0 ? combine(*identity, offsets[block]) : *identity;
+
+                for (auto i = begin; i < end; ++i)
+                {
+                    const T value = input[i];
+                    output[i] = sum;
+                    sum = combine(sum, value);
+                }
+            }
+            else
+            {
+                T sum = block > 0 ? combine(offsets[block], input[begin]) : input[begin];
+                output[begin] = sum;
+
+                for (auto i = begin + 1; i < end; ++i)
+                {
+                    sum = combine(sum, input[i]);
+                    output[i] = sum;
+                }
+            }
+        }
+    }, SchedulingPolicy::Dynamic);
+}
+
+} // namespace util
+
+template <typename T, typename Combine>
+void parallel_inclusive_scan(const std::vector<T> & input, std::vector<T> & output, Combine && combine)
+{
+    util::parallelScan(input, output, static_cast<const T *>(nullptr), combine);
+}
+
+template <typename T>
+void parallel_inclusive_scan(const std::vector<T> & input, std::vector<T> & output)
+{
+    parallel_inclusive_scan(input, output, std::plus<T>());
+}
+
+template <typename T, typename Combine>
+void parallel_exclusive_scan(const std::vector<T> & input, std::vector<T> & output, const T & identity, Combine && combine)
+{
+    util::parallelScan(input, output, &identity, combine);
+}
+
+template <typename T>
+void parallel_exclusive_scan(const std::vector<T> & input, std::vector<T> & output, const T & identity)
+{
+    parallel_exclusive_scan(input, output, identity, std::plus<T>());
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/**
+ * Sorts the values stably (like std::stable_sort) using a parallel merge sort:
+ * one block per thread is sorted concurrently, then pairs of blocks are merged
+ * level by level, each merge being split into independent segments.
+ *
+ * \code{.cpp}
+ * parallel_sort(points, [] (const Point & a, const Point & b) { return a.x < b.x; });
+ * \endcode
+ */
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T> & values, Compare && compare);
+
+template <typename T>
+void parallel_sort(std::vector<T> & values);
+
+/**
+ * Sorts integral or floating-point keys in ascending order using a parallel LSD radix sort
+ * (8 bit digits, per-thread histograms and stable scattering). Passes in which all keys
+ * share the same digit are skipped. Negative zero is ordered before positive zero,
+ * NaNs are ordered by their bit pattern.
+ */
+template <typename Key>
+void parallel_radix_sort(std::vector<Key> & keys);
+
+} // namespace threadingzeug
+
+#include <threadingzeug/parallelsort.hpp>
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <threadingzeug/parallelsort.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
+#include <threadingzeug/util.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+/**
+ * Maps keys to unsigned integers whose unsigned order equals the order of the keys.
+ */
+template <typename Key, typename Enable = void>
+struct RadixTraits;
+
+template <typename Key>
+struct RadixTraits<Key, typename std::enable_if<std::is_integral<Key>::value && !std::is_same<Key, bool>::value>::type>
+{
+    typedef typename std::make_unsigned<Key>::type Bits;
+
+    static const Bits s_offset = std::is_signed<Key>::value ? Bits(Bits(1) << (std::numeric_limits<Bits>::digits - 1)) : Bits(0);
+
+    static Bits encode(Key key)
+    {
+        return static_cast<Bits>(static_cast<Bits>(key) ^ s_offset);
+    }
+
+    static Key decode(Bits bits)
+    {
+        return static_cast<Key>(static_cast<Bits>(bits ^ s_offset));
+    }
+};
+
+template <typename Key>
+struct RadixTraits<Key, typename std::enable_if<std::is_floating_point<Key>::value>::type>
+{
+    static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "parallel_radix_sort supports 32 and 64 bit floating-point keys only");
+
+    typedef typename std::conditional<sizeof(Key) == 4, std::uint32_t, std::uint64_t>::type Bits;
+
+    static const Bits s_sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+
+    // negative keys are inverted completely, positive keys get their sign bit set
+    static Bits encode(Key key)
+    {
+        Bits bits;
+        std::memcpy(&bits, &key, sizeof(Key));
+
+        return bits & s_sign ? ~bits : bits | s_sign;
+    }
+
+    static Key decode(Bits bits)
+    {
+        bits = bits & s_sign ? bits & ~s_sign : ~bits;
+
+        Key key;
+        std::memcpy(&key, &bits, sizeof(Key));
+        return key;
+    }
+};
+
+/**
+ * Stably merges [first1, last1) and [first2, last2) into output, using up to segments
+ * concurrently merged segments. Segments are split at evenly spaced positions of the
+ * first range and the matching lower bounds in the second range.
+ */
+template <typename Iterator, typename OutputIterator, typename Compare>
+void parallelMerge(Iterator first1, Iterator last1, Iterator first2, Iterator last2, OutputIterator output, std::size_t segments, Compare & compare)
+{
+    const auto size1 = static_cast<std::size_t>(last1 - first1);
+    segments = std::max(std::size_t(1), std::min(segments, size1));
+
+    const auto split = [&] (std::size_t segment) -> std::pair<std::size_t, std::size_t>
+    {
+        const auto i = blockBegin(size1, segments, segment);
+
+        if (i == size1)
+            return std::make_pair(i, static_cast<std::size_t>(last2 - first2));
+
+        return std::make_pair(i, static_cast<std::size_t>(std::lower_bound(first2, last2, first1[i], compare) - first2));
+    };
+
+    parallel_for(Range<std::size_t>(0, segments), std::size_t(1), [&] (std::size_t first, std::size_t last)
+    {
+        for (auto segment = first; segment < last; ++segment)
+        {
+            const auto begin = segment == 0 ? std::make_pair(std::size_t(0), std::size_t(0)) : split(segment);
+            const auto end = split(segment + 1);
+
+            std::merge(
+                std::make_move_iterator(first1 + begin.first), std::make_move_iterator(first1 + end.first),
+                std::make_move_iterator(first2 + begin.second), std::make_move_iterator(first2 + end.second),
+                output + (begin.first + begin.second), compare);
+        }
+    }, SchedulingPolicy::Dynamic);
+}
+
+} // namespace util
+
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T> & values, Compare && compare)
+{
+    const auto size = values.size();
+    const std::size_t grain = 8192;
+
+    // a power of two number of blocks, at most one per thread
+    const auto participants = util::numberOfBlocks(size, grain);
+    auto blocks = std::size_t(1);
+    while (blocks * 2 <= participants)
+        blocks *= 2;
+
+    if (blocks == 1)
+    {
+        std::stable_sort(values.begin(), values.end(), compare);
+        return;
+    }
+
+    parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+    {
+        for (auto block = first; block < last; ++block)
+        {
+            std::stable_sort(
+                values.begin() + util::blockBegin(size, blocks, block),
+                values.begin() + util::blockBegin(size, blocks, block + 1), compare);
+        }
+    }, SchedulingPolicy::Dynamic);
+
+    auto buffer = values;
+    auto source = &values;
+    auto target = &buffer;
+
+    for (auto width = std::size_t(1); width < blocks; width *= 2)
+    {
+        const auto merges = blocks / (2 * width);
+
+        // the merges of one level run concurrently; each is split into segments,
+        // so that the few merges of the upper levels still keep all threads busy
+        parallel_for(Range<std::size_t>(0, merges), std::size_t(1), [&] (std::size_t first, std::size_t last)
+        {
+            for (auto merge = first; merge < last; ++merge)
+            {
+                const auto begin = util::blockBegin(size, blocks, 2 * merge * width);
+                const auto middle = util::blockBegin(size, blocks, (2 * merge + 1) * width);
+                const auto end = util::blockBegin(size, blocks, (2 * merge + 2) * width);
+
+                util::parallelMerge(
+                    source->begin() + begin, source->begin() + middle,
+                    source->begin() + middle, source->begin() + end,
+                    target->begin() + begin, 2 * width, compare);
+            }
+        }, SchedulingPolicy::Dynamic);
+
+        std::swap(source, target);
+    }
+
+    if (source != &values)
+        values.swap(buffer);
+}
+
+template <typename T>
+void parallel_sort(std::vector<T> & values)
+{
+    parallel_sort(values, std::less<T>());
+}
+
+template <typename Key>
+void parallel_radix_sort(std::vector<Key> & keys)
+{
+    typedef util::RadixTraits<Key> Traits;
+    typedef typename Traits::Bits Bits;
+    typedef std::array<std::size_t, 256> Histogram;
+
+    const auto size = keys.size();
+
+    if (size < 2)
+        return;
+
+    const auto blocks = util::numberOfBlocks(size, std::size_t(1) << 14);
+
+    auto source = std::vector<Bits>(size);
+    auto target = std::vector<Bits>(size);
+    auto histograms = std::vector<Histogram>(blocks);
+
+    parallel_for(std::size_t(0), size, [&keys, &source] (std::size_t i)
+    {
+        source[i] = Traits::encode(keys[i]);
+    });
+
+    for (auto shift = 0u; shift < sizeof(Bits) * 8; shift += 8)
+    {
+        parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+        {
+            for (auto block = first; block < last; ++block)
+            {
+                auto & histogram = histograms[block];
+                histogram.fill(0);
+
+                const auto end = util::blockBegin(size, blocks, block + 1);
+                for (auto i = util::blockBegin(size, blocks, block); i < end; ++i)
+                    ++histogram[(source[i] >> shift) & 0xff];
+            }
+        });
+
+        // a pass in which all keys share the same digit would not change their order
+        auto uniform = false;
+
+        for (auto digit = 0u; digit < 256u && !uniform; ++digit)
+        {
+            auto count = std::size_t(0);
+            for (const auto & histogram : histograms)
+                count += histogram[digit];
+
+            uniform = count == size;
+        }
+
+        if (uniform)
+            continue;
+
+        // turn the counts into scatter offsets, ordered by digit first and block second
+        auto offset = std::size_t(0);
+
+        for (auto digit = 0u; digit < 256u; ++digit)
+        {
+            for (auto & histogram : histograms)
+            {
+                const auto count = histogram[digit];
+                histogram[digit] = offset;
+                offset += count;
+            }
+        }
+
+        parallel_for(Range<std::size_t>(0, blocks), std::size_t(1), [&] (std::size_t first, std::size_t last)
+        {
+            for (auto block = first; block < last; ++block)
+            {
+                auto & histogram = histograms[block];
+
+                const auto end = util::blockBegin(size, blocks, block + 1);
+                for (auto i = util::blockBegin(size, blocks, block); i < end; ++i)
+                    target[histogram[(source[i] >> shift) & 0xff]++] = source[i];
+            }
+        });
+
+        source.swap(target);
+    }
+
+    parallel_for(std::size_t(0), size, [&keys, &source] (std::size_t i)
+    {
+        keys[i] = Traits::decode(source[i]);
+    });
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/**
+ * A NUMA node and the logical CPUs attached to it.
+ */
+struct NumaNode
+{
+    int id;
+    std::vector<int> cpus;
+};
+
+/**
+ * Returns the NUMA nodes with the CPUs the process may run on, ordered by node id.
+ * Where the topology is unknown (e.g., on other platforms than Linux), all CPUs form a single node 0.
+ */
+THREADINGZEUG_API std::vector<NumaNode> numaNodes();
+
+/**
+ * Returns the NUMA node of a logical CPU or -1 if it is unknown.
+ */
+THREADINGZEUG_API int numaNodeOf(int cpu);
+
+} // namespace threadingzeug
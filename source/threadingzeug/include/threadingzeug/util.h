@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <threadingzeug/threadingzeug_api.h>
+
+namespace threadingzeug
+{
+
+/**
+ * \brief Helpers shared by the header-only parallel algorithms.
+ */
+namespace util
+{
+
+/**
+ * Number of contiguous blocks to split size elements into: one per thread of the
+ * ThreadPool (including the calling thread), but none smaller than grain.
+ */
+inline std::size_t numberOfBlocks(std::size_t size, std::size_t grain);
+
+/**
+ * First index of block of numberOfBlocks nearly equally sized blocks over size elements.
+ * blockBegin(size, numberOfBlocks, numberOfBlocks) is size.
+ */
+inline std::size_t blockBegin(std::size_t size, std::size_t numberOfBlocks, std::size_t block);
+
+/**
+ * Combines values[i].*member pairwise in a fixed binary tree; the result ends up in values.front().
+ */
+template <typename T, typename Value, typename Combine>
+void combineTree(std::vector<Value> & values, T Value::* member, Combine && combine);
+
+} // namespace util
+
+} // namespace threadingzeug
+
+#include <threadingzeug/util.hpp>
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <threadingzeug/util.h>
+
+#include <algorithm>
+
+#include <threadingzeug/ThreadPool.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+inline std::size_t numberOfBlocks(std::size_t size, std::size_t grain)
+{
+    const auto participants = static_cast<std::size_t>(ThreadPool::instance().numberOfThreads()) + 1;
+    const auto chunk = std::max(grain, std::size_t(1));
+
+    return std::max(std::size_t(1), std::min(participants, (size + chunk - 1) / chunk));
+}
+
+inline std::size_t blockBegin(std::size_t size, std::size_t numberOfBlocks, std::size_t block)
+{
+    return size / numberOfBlocks * block + std::min(block, size % numberOfBlocks);
+}
+
+template <typename T, typename Value, typename Combine>
+void combineTree(std::vector<Value> & values, T Value::* member, Combine && combine)
+{
+    for (auto stride = std::size_t(1); stride < values.size(); stride *= 2)
+    {
+        for (auto i = std::size_t(0); i + stride < values.size(); i += 2 * stride)
+            values[i].*member = combine(values[i].*member, values[i + stride].*member);
+    }
+}
+
+} // namespace util
+
+} // namespace threadingzeug
@@ -0,0 +1,22 @@
+
+#include <threadingzeug/CancellationToken.h>
+
+namespace threadingzeug
+{
+
+CancellationToken::CancellationToken()
+: m_cancelled(std::make_shared<std::atomic<bool>>(false))
+{
+}
+
+void CancellationToken::cancel()
+{
+    m_cancelled->store(true);
+}
+
+bool CancellationToken::cancelled() const
+{
+    return m_cancelled->load(std::memory_order_relaxed);
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,107 @@
+
+#include <threadingzeug/Future.h>
+
+#include <threadingzeug/ThreadPool.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+AbstractFutureState::AbstractFutureState()
+: m_ready(false)
+, m_helpingPool(nullptr)
+{
+}
+
+AbstractFutureState::~AbstractFutureState()
+{
+}
+
+bool AbstractFutureState::ready() const
+{
+    return m_ready;
+}
+
+void AbstractFutureState::wait() const
+{
+    auto & pool = ThreadPool::instance();
+    const auto isReady = [this] () { return m_ready.load(); };
+
+    if (pool.currentWorker() < 0)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_readyCondition.wait(lock, isReady);
+        return;
+    }
+
+    // a blocked worker could be the one the awaited task is queued on, so it helps
+    // with pending tasks and sleeps in the pool when there are none
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_helpingPool = &pool;
+    }
+
+    pool.helpUntil(isReady);
+}
+
+std::exception_ptr AbstractFutureState::exception() const
+{
+    return m_exception;
+}
+
+void AbstractFutureState::setException(std::exception_ptr exception)
+{
+    m_exception = exception;
+    markReady();
+}
+
+void AbstractFutureState::onReady(std::function<void()> continuation)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_ready)
+        {
+            m_continuations.push_back(std::move(continuation));
+            return;
+        }
+    }
+
+    continuation();
+}
+
+void AbstractFutureState::markReady()
+{
+    std::vector<std::function<void()>> continuations;
+    ThreadPool * helpingPool;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_ready = true;
+        continuations.swap(m_continuations);
+        helpingPool = m_helpingPool;
+    }
+    m_readyCondition.notify_all();
+
+    if (helpingPool)
+        helpingPool->wakeBlockedWorkers();
+
+    for (auto & continuation : continuations)
+        continuation();
+}
+
+void FutureState<void>::setValue()
+{
+    markReady();
+}
+
+void FutureState<void>::value() const
+{
+}
+
+} // namespace util
+
+} // namespace threadingzeug
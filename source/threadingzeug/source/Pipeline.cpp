@@ -0,0 +1,152 @@
+
+#include <threadingzeug/Pipeline.h>
+
+#include <chrono>
+#include <thread>
+
+#include <threadingzeug/ThreadPool.h>
+
+namespace threadingzeug
+{
+
+namespace util
+{
+
+PipelineState::PipelineState(std::size_t capacity)
+: capacity(capacity > 0 ? capacity : 1)
+, inFlight(0)
+, exhausted(false)
+, failed(false)
+, progress(0)
+, sleeping(0)
+{
+}
+
+bool PipelineState::finished() const
+{
+    return failed || (exhausted && inFlight == 0);
+}
+
+void PipelineState::notifyProgress()
+{
+    ++progress;
+
+    // sleeping is incremented before progress is checked, so either side sees the other
+    if (sleeping > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        progressCondition.notify_all();
+    }
+}
+
+void PipelineState::waitForProgress(std::uint64_t seen)
+{
+    ++sleeping;
+
+    {
+        // the timeout lets waiting threads pick up unrelated tasks queued on the pool meanwhile
+        std::unique_lock<std::mutex> lock(mutex);
+        progressCondition.wait_for(lock, std::chrono::milliseconds(1), [this, seen] ()
+        {
+            return progress != seen || finished();
+        });
+    }
+
+    --sleeping;
+}
+
+AbstractPipelineStage::AbstractPipelineStage(std::shared_ptr<PipelineState> state, unsigned parallelism)
+: m_state(std::move(state))
+, m_parallelism(parallelism)
+, m_active(0)
+{
+}
+
+AbstractPipelineStage::~AbstractPipelineStage()
+{
+}
+
+bool AbstractPipelineStage::process()
+{
+    struct Activation
+    {
+        ~Activation()
+        {
+            --active;
+        }
+
+        std::atomic<unsigned> & active;
+    };
+
+    const auto active = ++m_active;
+    Activation activation{ m_active };
+
+    if (m_parallelism > 0 && active > m_parallelism)
+        return false;
+
+    return processItems();
+}
+
+} // namespace util
+
+Pipeline::Pipeline(std::shared_ptr<util::PipelineState> state, std::vector<std::unique_ptr<util::AbstractPipelineStage>> stages)
+: m_state(std::move(state))
+, m_stages(std::move(stages))
+{
+}
+
+Pipeline::Pipeline(Pipeline && other)
+: m_state(std::move(other.m_state))
+, m_stages(std::move(other.m_stages))
+{
+}
+
+Pipeline::~Pipeline()
+{
+}
+
+void Pipeline::run()
+{
+    auto & pool = ThreadPool::instance();
+    auto & state = *m_state;
+
+    // rounds without work a thread yields for before it sleeps until items are passed on
+    const auto spinRounds = 16u;
+
+    pool.execute(pool.numberOfThreads() + 1, [this, &pool, &state] (unsigned)
+        {
+            try
+            {
+                auto idleRounds = 0u;
+
+                while (!state.finished())
+                {
+                    const auto seen = state.progress.load();
+
+                    // later stages first, so that items leave the pipeline before new ones enter
+                    auto processed = false;
+                    for (auto stage = m_stages.rbegin(); stage != m_stages.rend(); ++stage)
+                        processed = (*stage)->process() || processed;
+
+                    if (processed || pool.runPendingTask())
+                    {
+                        idleRounds = 0;
+                        continue;
+                    }
+
+                    if (++idleRounds < spinRounds)
+                        std::this_thread::yield();
+                    else
+                        state.waitForProgress(seen);
+                }
+            }
+            catch (...)
+            {
+                state.failed = true;
+                state.notifyProgress();
+                throw;
+            }
+        });
+}
+
+} // namespace threadingzeug
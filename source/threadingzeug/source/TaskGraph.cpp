@@ -0,0 +1,146 @@
+
+#include <threadingzeug/TaskGraph.h>
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+
+#include <threadingzeug/ThreadPool.h>
+
+
+namespace
+{
+
+/*  State of one launch: remaining dependency counts per node and
+    the number of nodes that have not finished yet.
+*/
+struct Execution : public std::enable_shared_from_this<Execution>
+{
+    struct Node
+    {
+        std::function<void()> task;
+        std::vector<std::size_t> successors;
+        std::atomic<std::size_t> dependencies;
+    };
+
+    explicit Execution(std::size_t size)
+    : nodes(size)
+    , remaining(size)
+    , failed(false)
+    , result(std::make_shared<threadingzeug::util::FutureState<void>>())
+    {
+    }
+
+    void schedule(std::size_t index)
+    {
+        auto self = shared_from_this();
+
+        threadingzeug::ThreadPool::instance().submit([self, index] ()
+        {
+            self->execute(index);
+        });
+    }
+
+    void execute(std::size_t index)
+    {
+        auto & node = nodes[index];
+
+        if (!failed)
+        {
+            try
+            {
+                node.task();
+            }
+            catch (...)
+            {
+                if (!failed.exchange(true))
+                    exception = std::current_exception();
+            }
+        }
+
+        for (auto successor : node.successors)
+        {
+            if (--nodes[successor].dependencies == 0)
+                schedule(successor);
+        }
+
+        if (--remaining > 0)
+            return;
+
+        if (exception)
+            result->setException(exception);
+        else
+            result->setValue();
+    }
+
+    std::vector<Node> nodes;
+    std::atomic<std::size_t> remaining;
+
+    std::atomic<bool> failed;
+    std::exception_ptr exception;
+
+    std::shared_ptr<threadingzeug::util::FutureState<void>> result;
+};
+
+} // namespace
+
+
+namespace threadingzeug
+{
+
+TaskGraph::TaskGraph()
+{
+}
+
+TaskGraph::Node TaskGraph::add(Task task, const std::vector<Node> & dependencies)
+{
+    const auto node = m_nodes.size();
+
+    for (auto dependency : dependencies)
+    {
+        assert(dependency < node);
+        m_nodes[dependency].successors.push_back(node);
+    }
+
+    m_nodes.push_back(NodeData{ std::move(task), std::vector<Node>(), dependencies.size() });
+
+    return node;
+}
+
+std::size_t TaskGraph::size() const
+{
+    return m_nodes.size();
+}
+
+Future<void> TaskGraph::launch() const
+{
+    auto execution = std::make_shared<Execution>(m_nodes.size());
+
+    if (m_nodes.empty())
+    {
+        execution->result->setValue();
+        return Future<void>(execution->result);
+    }
+
+    for (auto i = std::size_t(0); i < m_nodes.size(); ++i)
+    {
+        execution->nodes[i].task = m_nodes[i].task;
+        execution->nodes[i].successors = m_nodes[i].successors;
+        execution->nodes[i].dependencies = m_nodes[i].numberOfDependencies;
+    }
+
+    for (auto i = std::size_t(0); i < m_nodes.size(); ++i)
+    {
+        if (m_nodes[i].numberOfDependencies == 0)
+            execution->schedule(i);
+    }
+
+    return Future<void>(execution->result);
+}
+
+void TaskGraph::run() const
+{
+    launch().get();
+}
+
+} // namespace threadingzeug
@@ -0,0 +1,466 @@
+
+#include <threadingzeug/ThreadPool.h>
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <exception>
+#include <thread>
+
+#include <threadingzeug/topology.h>
+
+#include "tracing.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace
+{
+
+std::mutex s_instanceMutex;
+std::unique_ptr<threadingzeug::ThreadPool> s_instance;
+
+thread_local const threadingzeug::ThreadPool * t_pool = nullptr;
+thread_local unsigned t_worker = 0;
+
+void pinCurrentThread(int cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+/*  Shared state of one execute() call. Helper tasks that start after all jobs
+    have been claimed return immediately, so they never touch the job itself.
+    Once a job has thrown, the remaining jobs are skipped but still count as finished.
+*/
+struct JobGroup
+{
+    JobGroup(threadingzeug::ThreadPool & pool, unsigned count, const threadingzeug::ThreadPool::Job & job)
+    : pool(pool)
+    , count(count)
+    , job(&job)
+    , next(0)
+    , finished(0)
+    , failed(false)
+    {
+    }
+
+    void work()
+    {
+        unsigned index;
+        while ((index = next++) < count)
+            run(index);
+    }
+
+    void run(unsigned index)
+    {
+        if (!failed)
+        {
+            try
+            {
+                (*job)(index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!failed.exchange(true))
+                    exception = std::current_exception();
+            }
+        }
+
+        if (++finished == count)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+
+            pool.wakeBlockedWorkers();
+        }
+    }
+
+    /*  A worker waiting for jobs in flight on other workers runs pending tasks meanwhile,
+        e.g., the jobs of loops nested in those jobs. Without that, every level of nesting
+        would block another worker, and inner loops could only run on the waiting thread.
+    */
+    void wait()
+    {
+        const auto finishedAll = [this] () { return finished == count; };
+
+        if (pool.currentWorker() < 0)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, finishedAll);
+            return;
+        }
+
+        pool.helpUntil(finishedAll);
+    }
+
+    threadingzeug::ThreadPool & pool;
+    const unsigned count;
+    const threadingzeug::ThreadPool::Job * job;
+
+    std::atomic<unsigned> next;
+    std::atomic<unsigned> finished;
+    std::atomic<bool> failed;
+    std::exception_ptr exception;
+
+    std::mutex mutex;
+    std::condition_variable done;
+};
+
+} // namespace
+
+
+namespace threadingzeug
+{
+
+struct ThreadPool::Worker
+{
+    std::thread thread;
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::deque<Task> pinned;
+    std::atomic<unsigned> pinnedPending{ 0 };
+};
+
+ThreadPool & ThreadPool::instance()
+{
+    std::lock_guard<std::mutex> lock(s_instanceMutex);
+
+    if (!s_instance)
+        s_instance.reset(new ThreadPool);
+
+    return *s_instance;
+}
+
+void ThreadPool::configure(unsigned numberOfThreads, const std::vector<int> & affinity)
+{
+    std::lock_guard<std::mutex> lock(s_instanceMutex);
+
+    s_instance.reset();
+    s_instance.reset(new ThreadPool(numberOfThreads, affinity));
+}
+
+void ThreadPool::configure(unsigned numberOfThreads, Placement placement)
+{
+    configure(numberOfThreads, affinityFor(numberOfThreads, placement));
+}
+
+std::vector<int> ThreadPool::affinityFor(unsigned numberOfThreads, Placement placement)
+{
+    std::vector<int> affinity;
+
+    if (placement == Placement::Unpinned)
+        return affinity;
+
+    if (numberOfThreads == 0)
+    {
+        const auto concurrency = std::thread::hardware_concurrency();
+        numberOfThreads = concurrency > 1 ? concurrency - 1 : 1;
+    }
+
+    const auto nodes = numaNodes();
+
+    if (placement == Placement::Compact)
+    {
+        while (affinity.size() < numberOfThreads)
+        {
+            for (const auto & node : nodes)
+                affinity.insert(affinity.end(), node.cpus.begin(), node.cpus.end());
+        }
+    }
+    else
+    {
+        // node i gets an even share of the workers, taken from its CPUs in order
+        for (auto i = std::size_t(0); i < nodes.size(); ++i)
+        {
+            const auto & cpus = nodes[i].cpus;
+            const auto first = numberOfThreads * i / nodes.size();
+            const auto last = numberOfThreads * (i + 1) / nodes.size();
+
+            for (auto j = first; j < last; ++j)
+                affinity.push_back(cpus[(j - first) % cpus.size()]);
+        }
+    }
+
+    affinity.resize(numberOfThreads);
+    return affinity;
+}
+
+ThreadPool::ThreadPool(unsigned numberOfThreads, const std::vector<int> & affinity)
+: m_affinity(affinity)
+, m_pending(0)
+, m_nextWorker(0)
+, m_stop(false)
+, m_blocked(0)
+{
+    if (numberOfThreads == 0)
+    {
+        const auto concurrency = std::thread::hardware_concurrency();
+        numberOfThreads = concurrency > 1 ? concurrency - 1 : 1;
+    }
+
+    for (auto i = 0u; i < numberOfThreads; ++i)
+        m_workers.emplace_back(new Worker);
+
+    for (auto i = 0u; i < numberOfThreads; ++i)
+        m_workers[i]->thread = std::thread(&ThreadPool::run, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (auto & worker : m_workers)
+        worker->thread.join();
+}
+
+unsigned ThreadPool::numberOfThreads() const
+{
+    return static_cast<unsigned>(m_workers.size());
+}
+
+int ThreadPool::currentWorker() const
+{
+    return t_pool == this ? static_cast<int>(t_worker) : -1;
+}
+
+int ThreadPool::numaNode(unsigned worker) const
+{
+    if (m_affinity.empty())
+        return -1;
+
+    return numaNodeOf(m_affinity[worker % m_affinity.size()]);
+}
+
+void ThreadPool::submit(Task task)
+{
+    const auto index = t_pool == this ? t_worker : m_nextWorker++ % numberOfThreads();
+
+    {
+        std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+        m_workers[index]->tasks.push_back(std::move(task));
+    }
+    ++m_pending;
+
+    auto blocked = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        blocked = m_blocked > 0;
+    }
+    m_wakeUp.notify_one();
+
+    if (blocked)
+        m_workAvailable.notify_all();
+}
+
+void ThreadPool::execute(unsigned numberOfJobs, const Job & job)
+{
+    if (numberOfJobs == 0)
+        return;
+
+    if (numberOfJobs == 1)
+    {
+        job(0);
+        return;
+    }
+
+    auto group = std::make_shared<JobGroup>(*this, numberOfJobs, job);
+
+    const auto helpers = std::min(numberOfJobs - 1, numberOfThreads());
+    for (auto i = 0u; i < helpers; ++i)
+        submit([group] () { group->work(); });
+
+    group->work();
+    group->wait();
+
+    if (group->failed)
+        std::rethrow_exception(group->exception);
+}
+
+void ThreadPool::submitTo(unsigned worker, Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_workers[worker]->mutex);
+        m_workers[worker]->pinned.push_back(std::move(task));
+        ++m_workers[worker]->pinnedPending;
+    }
+
+    // all workers wait on the same condition, so the worker concerned may not be the one woken by notify_one
+    auto blocked = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        blocked = m_blocked > 0;
+    }
+    m_wakeUp.notify_all();
+
+    if (blocked)
+        m_workAvailable.notify_all();
+}
+
+void ThreadPool::executePinned(const Job & job)
+{
+    auto group = std::make_shared<JobGroup>(*this, numberOfThreads(), job);
+    const auto current = currentWorker();
+
+    for (auto i = 0u; i < numberOfThreads(); ++i)
+    {
+        if (static_cast<int>(i) != current)
+            submitTo(i, [group, i] () { group->run(i); });
+    }
+
+    if (current >= 0)
+        group->run(static_cast<unsigned>(current));
+
+    group->wait();
+
+    if (group->failed)
+        std::rethrow_exception(group->exception);
+}
+
+bool ThreadPool::runPendingTask()
+{
+    const auto index = t_pool == this ? t_worker : 0u;
+
+    Task task;
+    if (!(t_pool == this && popPinned(index, task)) && !pop(index, task) && !steal(index, task))
+        return false;
+
+    THREADINGZEUG_TRACE_TASK();
+    task();
+    return true;
+}
+
+void ThreadPool::helpUntil(const std::function<bool()> & isDone)
+{
+    assert(t_pool == this);
+
+    const auto index = t_worker;
+
+    while (!isDone())
+    {
+        if (runPendingTask())
+            continue;
+
+        // checked under m_mutex, which submit() and wakeBlockedWorkers() take before notifying
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        ++m_blocked;
+        m_workAvailable.wait(lock, [this, index, &isDone] () { return isDone() || m_pending > 0 || m_workers[index]->pinnedPending > 0; });
+        --m_blocked;
+    }
+}
+
+void ThreadPool::wakeBlockedWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_blocked == 0)
+            return;
+    }
+
+    m_workAvailable.notify_all();
+}
+
+void ThreadPool::run(unsigned index)
+{
+    t_pool = this;
+    t_worker = index;
+
+    THREADINGZEUG_TRACE_WORKER(static_cast<int>(index));
+
+    if (!m_affinity.empty())
+        pinCurrentThread(m_affinity[index % m_affinity.size()]);
+
+    Task task;
+
+    while (true)
+    {
+        if (popPinned(index, task) || pop(index, task) || steal(index, task))
+        {
+            THREADINGZEUG_TRACE_TASK();
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        THREADINGZEUG_TRACE_IDLE();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeUp.wait(lock, [this, index] () { return m_stop || m_pending > 0 || m_workers[index]->pinnedPending > 0; });
+
+        if (m_stop && m_pending == 0)
+            return;
+    }
+}
+
+bool ThreadPool::popPinned(unsigned index, Task & task)
+{
+    auto & worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.pinned.empty())
+        return false;
+
+    task = std::move(worker.pinned.front());
+    worker.pinned.pop_front();
+    --worker.pinnedPending;
+
+    return true;
+}
+
+bool ThreadPool::pop(unsigned index, Task & task)
+{
+    auto & worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.tasks.empty())
+        return false;
+
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    --m_pending;
+
+    return true;
+}
+
+bool ThreadPool::steal(unsigned index, Task & task)
+{
+    const auto count = numberOfThreads();
+
+    for (auto i = 1u; i < count; ++i)
+    {
+        auto & victim = *m_workers[(index + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (victim.tasks.empty())
+            continue;
+
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        --m_pending;
+
+        THREADINGZEUG_TRACE_STEAL();
+
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace threadingzeug
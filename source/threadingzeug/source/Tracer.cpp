@@ -0,0 +1,447 @@
+
+#include <threadingzeug/Tracer.h>
+
+#include <fstream>
+#include <ostream>
+
+#include "tracing.h"
+
+#ifdef THREADINGZEUG_TRACING
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#endif
+
+
+#ifdef THREADINGZEUG_TRACING
+
+namespace
+{
+
+using threadingzeug::LoopRecord;
+using threadingzeug::SchedulingPolicy;
+using threadingzeug::ThreadCounters;
+using threadingzeug::tracing::Scope;
+
+struct Event
+{
+    Scope::Kind kind;
+    std::uint64_t begin;
+    std::uint64_t duration;
+    std::int64_t size;
+};
+
+/*  Counters and events of one thread. Only its thread writes them; the mutex is
+    uncontended unless the recording is read concurrently.
+*/
+struct ThreadLog
+{
+    explicit ThreadLog(unsigned id)
+    : id(id)
+    , alive(true)
+    , depth(0)
+    {
+        counters.worker = -1;
+        clear();
+    }
+
+    void clear()
+    {
+        counters = ThreadCounters{ worker(), 0, 0, 0, 0, 0, 0, std::numeric_limits<std::uint64_t>::max(), 0 };
+        events.clear();
+    }
+
+    int worker() const
+    {
+        return counters.worker;
+    }
+
+    const unsigned id;
+    bool alive;
+    unsigned depth;
+
+    std::mutex mutex;
+    ThreadCounters counters;
+    std::vector<Event> events;
+};
+
+std::atomic<bool> s_recording(false);
+std::atomic<std::uint64_t> s_epoch(0);
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadLog>> logs;
+    std::vector<LoopRecord> loops;
+    unsigned nextId = 0;
+};
+
+// never destroyed, since workers of the process-wide ThreadPool may still record during static destruction
+Registry & registry()
+{
+    static auto registry = new Registry;
+    return *registry;
+}
+
+std::uint64_t now()
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// marks the log of an exiting thread, so that start() can drop it
+struct LogOwner
+{
+    ~LogOwner()
+    {
+        if (!log)
+            return;
+
+        std::lock_guard<std::mutex> lock(log->mutex);
+        log->alive = false;
+    }
+
+    std::shared_ptr<ThreadLog> log;
+};
+
+thread_local LogOwner t_log;
+
+ThreadLog & currentLog()
+{
+    if (!t_log.log)
+    {
+        auto & registry = ::registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        t_log.log = std::make_shared<ThreadLog>(registry.nextId++);
+        registry.logs.push_back(t_log.log);
+    }
+
+    return *t_log.log;
+}
+
+const char * name(Scope::Kind kind)
+{
+    switch (kind)
+    {
+    case Scope::Kind::Task:  return "task";
+    case Scope::Kind::Idle:  return "idle";
+    case Scope::Kind::Chunk: return "chunk";
+    case Scope::Kind::Loop:  return "parallel_for";
+    case Scope::Kind::Steal: return "steal";
+    }
+    return "";
+}
+
+const char * name(SchedulingPolicy policy)
+{
+    switch (policy)
+    {
+    case SchedulingPolicy::Static:  return "static";
+    case SchedulingPolicy::Dynamic: return "dynamic";
+    case SchedulingPolicy::Guided:  return "guided";
+    case SchedulingPolicy::Pinned:  return "pinned";
+    }
+    return "";
+}
+
+} // namespace
+
+
+namespace threadingzeug
+{
+
+namespace tracing
+{
+
+bool recording()
+{
+    return s_recording.load(std::memory_order_relaxed);
+}
+
+void setWorker(int worker)
+{
+    auto & log = currentLog();
+
+    std::lock_guard<std::mutex> lock(log.mutex);
+    log.counters.worker = worker;
+}
+
+void steal()
+{
+    if (!recording())
+        return;
+
+    auto & log = currentLog();
+
+    std::lock_guard<std::mutex> lock(log.mutex);
+    ++log.counters.steals;
+    log.events.push_back(Event{ Scope::Kind::Steal, now() - s_epoch, 0, 0 });
+}
+
+Scope::Scope(Kind kind, std::int64_t size, std::int64_t grain, SchedulingPolicy policy)
+: m_kind(kind)
+, m_active(recording())
+, m_size(size)
+, m_grain(grain)
+, m_policy(policy)
+, m_begin(0)
+{
+    if (!m_active)
+        return;
+
+    ++currentLog().depth;
+    m_begin = now();
+}
+
+Scope::~Scope()
+{
+    if (!m_active)
+        return;
+
+    const auto end = now();
+    const auto duration = end - m_begin;
+
+    auto & log = currentLog();
+    const auto outermost = --log.depth == 0;
+
+    {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        auto & counters = log.counters;
+
+        switch (m_kind)
+        {
+        case Kind::Task:
+            ++counters.tasks;
+            // tasks run by a waiting task are part of the waiting task's busy time
+            if (outermost)
+                counters.busyNanoseconds += duration;
+            break;
+
+        case Kind::Idle:
+            counters.idleNanoseconds += duration;
+            break;
+
+        case Kind::Chunk:
+            ++counters.chunks;
+            counters.chunkIndices += static_cast<std::uint64_t>(m_size);
+            counters.minChunkSize = std::min(counters.minChunkSize, static_cast<std::uint64_t>(m_size));
+            counters.maxChunkSize = std::max(counters.maxChunkSize, static_cast<std::uint64_t>(m_size));
+            break;
+
+        case Kind::Loop:
+        case Kind::Steal:
+            break;
+        }
+
+        log.events.push_back(Event{ m_kind, m_begin - s_epoch, duration, m_size });
+    }
+
+    if (m_kind == Kind::Loop)
+    {
+        auto & registry = ::registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.loops.push_back(LoopRecord{ m_size, m_grain, m_policy, duration });
+    }
+}
+
+} // namespace tracing
+
+bool Tracer::available()
+{
+    return true;
+}
+
+void Tracer::start()
+{
+    auto & registry = ::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto & logs = registry.logs;
+    logs.erase(std::remove_if(logs.begin(), logs.end(), [] (const std::shared_ptr<ThreadLog> & log)
+        {
+            std::lock_guard<std::mutex> lock(log->mutex);
+            return !log->alive;
+        }), logs.end());
+
+    for (auto & log : logs)
+    {
+        std::lock_guard<std::mutex> lock(log->mutex);
+        log->clear();
+    }
+
+    registry.loops.clear();
+    s_epoch = now();
+    s_recording = true;
+}
+
+void Tracer::stop()
+{
+    s_recording = false;
+}
+
+bool Tracer::recording()
+{
+    return tracing::recording();
+}
+
+std::vector<ThreadCounters> Tracer::counters()
+{
+    std::vector<ThreadCounters> counters;
+
+    auto & registry = ::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (const auto & log : registry.logs)
+    {
+        std::lock_guard<std::mutex> lock(log->mutex);
+
+        if (log->events.empty())
+            continue;
+
+        counters.push_back(log->counters);
+
+        if (counters.back().chunks == 0)
+            counters.back().minChunkSize = 0;
+    }
+
+    return counters;
+}
+
+std::vector<LoopRecord> Tracer::loops()
+{
+    auto & registry = ::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.loops;
+}
+
+void Tracer::writeChromeTrace(std::ostream & stream)
+{
+    // the trace event format expects microseconds
+    const auto microseconds = [] (std::uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1000.0; };
+
+    stream << "{\"traceEvents\":[";
+
+    auto & registry = ::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto first = true;
+    const auto separate = [&stream, &first] ()
+    {
+        stream << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    for (const auto & log : registry.logs)
+    {
+        std::lock_guard<std::mutex> lock(log->mutex);
+
+        if (log->events.empty())
+            continue;
+
+        const auto tid = log->id;
+
+        separate();
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":\"";
+        if (log->worker() < 0)
+            stream << "thread " << tid;
+        else
+            stream << "worker " << log->worker();
+        stream << "\"}}";
+
+        for (const auto & event : log->events)
+        {
+            separate();
+
+            if (event.kind == Scope::Kind::Steal)
+            {
+                stream << "{\"name\":\"steal\",\"cat\":\"scheduler\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << tid
+                    << ",\"ts\":" << microseconds(event.begin) << "}";
+                continue;
+            }
+
+            stream << "{\"name\":\"" << name(event.kind) << "\",\"cat\":\"scheduler\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                << ",\"ts\":" << microseconds(event.begin) << ",\"dur\":" << microseconds(event.duration);
+
+            if (event.kind == Scope::Kind::Chunk || event.kind == Scope::Kind::Loop)
+                stream << ",\"args\":{\"size\":" << event.size << "}";
+
+            stream << "}";
+        }
+    }
+
+    stream << "\n],\"otherData\":{\"loops\":[";
+
+    for (auto i = std::size_t(0); i < registry.loops.size(); ++i)
+    {
+        const auto & loop = registry.loops[i];
+        stream << (i ? "," : "") << "{\"size\":" << loop.size << ",\"grain\":" << loop.grain
+            << ",\"policy\":\"" << name(loop.policy) << "\",\"wall_us\":" << microseconds(loop.wallNanoseconds) << "}";
+    }
+
+    stream << "]}}\n";
+}
+
+} // namespace threadingzeug
+
+#else
+
+namespace threadingzeug
+{
+
+bool Tracer::available()
+{
+    return false;
+}
+
+void Tracer::start()
+{
+}
+
+void Tracer::stop()
+{
+}
+
+bool Tracer::recording()
+{
+    return false;
+}
+
+std::vector<ThreadCounters> Tracer::counters()
+{
+    return std::vector<ThreadCounters>();
+}
+
+std::vector<LoopRecord> Tracer::loops()
+{
+    return std::vector<LoopRecord>();
+}
+
+void Tracer::writeChromeTrace(std::ostream & stream)
+{
+    stream << "{\"traceEvents\":[]}\n";
+}
+
+} // namespace threadingzeug
+
+#endif
+
+
+namespace threadingzeug
+{
+
+bool Tracer::writeChromeTrace(const std::string & fileName)
+{
+    std::ofstream stream(fileName);
+
+    if (!stream)
+        return false;
+
+    writeChromeTrace(stream);
+    return static_cast<bool>(stream);
+}
+
+} // namespace threadingzeug
@@ -1,39 +1,169 @@
 
-#include <thread>
-#include <vector>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 
 #include <threadingzeug/parallelfor.h>
+#include <threadingzeug/ThreadPool.h>
 
-namespace threadingzeug
+#include "tracing.h"
+
+namespace
 {
 
-void parallel_for(int start, int end, std::function<void(int i)> callback)
+using threadingzeug::CancellationToken;
+using threadingzeug::Range;
+using threadingzeug::SchedulingPolicy;
+using threadingzeug::ThreadPool;
+
+void schedule(const Range<std::int64_t> & range, std::int64_t grain, const std::function<void(std::int64_t begin, std::int64_t end)> & callback, SchedulingPolicy policy, const CancellationToken * token)
 {
-#ifdef USE_OPENMP
+    if (range.empty())
+        return;
 
-    #pragma omp parallel for
-    for (int i = start; i < end; ++i)
-        callback(i);
+    THREADINGZEUG_TRACE_LOOP(range.size(), grain, policy);
 
-#else
+    auto & pool = ThreadPool::instance();
 
-    const auto numberOfThreads = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
-	std::vector<std::thread> threads(numberOfThreads);
-	
-	for (auto i = 0; i < numberOfThreads; ++i)
-	{
-		threads[i] = std::thread([numberOfThreads, start, end, i, &callback] ()
+    const auto begin = range.begin();
+    const auto end = range.end();
+    const auto size = end - begin;
+    const auto chunk = std::max(grain, std::int64_t(1));
+    const std::int64_t participants = pool.numberOfThreads() + 1;
+
+    // static blocks are equal in size, so a partial chunk must not add a job of its own
+    const auto chunks = policy == SchedulingPolicy::Static ? std::max(size / chunk, std::int64_t(1)) : (size + chunk - 1) / chunk;
+    const auto numberOfJobs = static_cast<unsigned>(std::min(participants, chunks));
+
+    if (numberOfJobs <= 1 && policy != SchedulingPolicy::Pinned)
+    {
+        if (!token || !token->cancelled())
+        {
+            THREADINGZEUG_TRACE_CHUNK(range.begin(), range.end());
+            callback(range.begin(), range.end());
+        }
+        return;
+    }
+
+    std::atomic<std::int64_t> next(begin);
+    std::atomic<bool> failed(false);
+
+    // a throwing block stops the loop like a cancellation; ThreadPool::execute rethrows the exception
+    const auto stopped = [&failed, token] ()
+    {
+        return failed || (token && token->cancelled());
+    };
+
+    const auto run = [&failed, &callback] (std::int64_t first, std::int64_t last)
+    {
+        try
+        {
+            THREADINGZEUG_TRACE_CHUNK(first, last);
+            callback(first, last);
+        }
+        catch (...)
+        {
+            failed = true;
+            throw;
+        }
+    };
+
+    switch (policy)
+    {
+    case SchedulingPolicy::Static:
+        pool.execute(numberOfJobs, [begin, size, numberOfJobs, &stopped, &run] (unsigned job)
             {
-                for (auto k = start + i; k < end; k += numberOfThreads)
-                    callback(k);
+                // the first size % numberOfJobs blocks get one additional index
+                const auto block = size / numberOfJobs;
+                const auto extra = size % numberOfJobs;
+
+                const auto first = begin + block * job + std::min<std::int64_t>(job, extra);
+                const auto last = first + block + (job < extra ? 1 : 0);
+
+                if (!stopped())
+                    run(first, last);
             });
-	}
+        break;
+
+    case SchedulingPolicy::Dynamic:
+        pool.execute(numberOfJobs, [end, chunk, &next, &stopped, &run] (unsigned)
+            {
+                std::int64_t first;
+                while (!stopped() && (first = next.fetch_add(chunk)) < end)
+                    run(first, std::min(first + chunk, end));
+            });
+        break;
+
+    case SchedulingPolicy::Guided:
+        pool.execute(numberOfJobs, [end, chunk, participants, &next, &stopped, &run] (unsigned)
+            {
+                auto first = next.load();
+                while (first < end && !stopped())
+                {
+                    const auto remaining = end - first;
+                    auto count = std::max(chunk, remaining / (2 * participants));
+
+                    // do not leave a tail smaller than grain
+                    if (remaining - count < chunk)
+                        count = remaining;
+
+                    if (!next.compare_exchange_weak(first, first + count))
+                        continue;
+
+                    run(first, first + count);
+                    first = next.load();
+                }
+            });
+        break;
+
+    case SchedulingPolicy::Pinned:
+        pool.executePinned([begin, size, &pool, &stopped, &run] (unsigned job)
+            {
+                // the blocks depend on the range and the number of workers only, as Static does
+                const std::int64_t workers = pool.numberOfThreads();
+                const auto block = size / workers;
+                const auto extra = size % workers;
+
+                const auto first = begin + block * job + std::min<std::int64_t>(job, extra);
+                const auto last = first + block + (job < extra ? 1 : 0);
+
+                if (first < last && !stopped())
+                    run(first, last);
+            });
+        break;
+    }
+}
+
+} // namespace
+
+
+namespace threadingzeug
+{
 
-	for (auto & thread : threads)
-		thread.join();
+void parallel_for(int start, int end, std::function<void(int i)> callback)
+{
+    parallel_for(start, end, [&callback] (int i)
+        {
+            callback(i);
+        });
+}
 
-#endif
+void parallel_for(const Range<int> & range, int grain, std::function<void(int begin, int end)> callback, SchedulingPolicy policy)
+{
+    parallel_for(range, grain, [&callback] (int begin, int end)
+        {
+            callback(begin, end);
+        }, policy);
+}
+
+void parallel_for(const Range<std::int64_t> & range, std::int64_t grain, std::function<void(std::int64_t begin, std::int64_t end)> callback, SchedulingPolicy policy)
+{
+    schedule(range, grain, callback, policy, nullptr);
+}
+
+void parallel_for(const Range<std::int64_t> & range, std::int64_t grain, std::function<void(std::int64_t begin, std::int64_t end)> callback, SchedulingPolicy policy, const CancellationToken & token)
+{
+    schedule(range, grain, callback, policy, &token);
 }
 
 void sequential_for(int start, int end, std::function<void(int i)> callback)
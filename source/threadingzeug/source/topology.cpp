@@ -0,0 +1,137 @@
+
+#include <threadingzeug/topology.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+
+namespace
+{
+
+using threadingzeug::NumaNode;
+
+// parses sysfs cpu lists like "0-3,8-11"
+std::vector<int> parseCpuList(const std::string & list)
+{
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string item;
+
+    while (std::getline(stream, item, ','))
+    {
+        if (item.empty() || item == "\n")
+            continue;
+
+        const auto dash = item.find('-');
+        const auto first = std::stoi(item.substr(0, dash));
+        const auto last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+
+        for (auto cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+    }
+
+    return cpus;
+}
+
+bool allowed(int cpu)
+{
+#ifdef __linux__
+    static const auto mask = [] ()
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &set) != 0)
+            CPU_ZERO(&set);
+
+        return set;
+    }();
+
+    return CPU_COUNT(&mask) == 0 || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &mask));
+#else
+    (void)cpu;
+    return true;
+#endif
+}
+
+std::vector<NumaNode> readNodes()
+{
+    std::vector<NumaNode> nodes;
+
+#ifdef __linux__
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+
+    if (online && std::getline(online, list))
+    {
+        for (auto id : parseCpuList(list))
+        {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist");
+            std::string cpus;
+
+            if (!file || !std::getline(file, cpus))
+                continue;
+
+            NumaNode node{ id, std::vector<int>() };
+
+            for (auto cpu : parseCpuList(cpus))
+            {
+                if (allowed(cpu))
+                    node.cpus.push_back(cpu);
+            }
+
+            if (!node.cpus.empty())
+                nodes.push_back(node);
+        }
+    }
+#endif
+
+    if (nodes.empty())
+    {
+        NumaNode node{ 0, std::vector<int>() };
+
+        const auto count = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        for (auto cpu = 0; cpu < count || (node.cpus.empty() && cpu < 1024); ++cpu)
+        {
+            if (allowed(cpu))
+                node.cpus.push_back(cpu);
+        }
+
+        nodes.push_back(node);
+    }
+
+    return nodes;
+}
+
+} // namespace
+
+
+namespace threadingzeug
+{
+
+std::vector<NumaNode> numaNodes()
+{
+    // the topology does not change while the process runs
+    static const auto nodes = readNodes();
+    return nodes;
+}
+
+int numaNodeOf(int cpu)
+{
+    for (const auto & node : numaNodes())
+    {
+        if (std::find(node.cpus.begin(), node.cpus.end(), cpu) != node.cpus.end())
+            return node.id;
+    }
+
+    return -1;
+}
+
+} // namespace threadingzeug
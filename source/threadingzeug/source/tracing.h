@@ -0,0 +1,76 @@
+#pragma once
+
+/*  Instrumentation hooks of the scheduler, see Tracer.
+    Without THREADINGZEUG_TRACING they expand to nothing.
+*/
+
+#ifdef THREADINGZEUG_TRACING
+
+#include <cstdint>
+
+#include <threadingzeug/parallelfor.h>
+
+namespace threadingzeug
+{
+
+namespace tracing
+{
+
+bool recording();
+
+void setWorker(int worker);
+void steal();
+
+/*  Records a span on the calling thread while in scope; does nothing if
+    recording is not active on construction.
+*/
+class Scope
+{
+public:
+    enum class Kind : char
+    {
+        Task,
+        Idle,
+        Chunk,
+        Loop,
+        Steal   // no scope, recorded by steal()
+    };
+
+public:
+    Scope(Kind kind, std::int64_t size = 0, std::int64_t grain = 0, SchedulingPolicy policy = SchedulingPolicy::Static);
+    ~Scope();
+
+protected:
+    Kind m_kind;
+    bool m_active;
+    std::int64_t m_size;
+    std::int64_t m_grain;
+    SchedulingPolicy m_policy;
+    std::uint64_t m_begin;
+};
+
+} // namespace tracing
+
+} // namespace threadingzeug
+
+#define THREADINGZEUG_TRACE_CONCAT_(a, b) a##b
+#define THREADINGZEUG_TRACE_CONCAT(a, b) THREADINGZEUG_TRACE_CONCAT_(a, b)
+#define THREADINGZEUG_TRACE_SCOPE(...) threadingzeug::tracing::Scope THREADINGZEUG_TRACE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
+
+#define THREADINGZEUG_TRACE_WORKER(worker) threadingzeug::tracing::setWorker(worker)
+#define THREADINGZEUG_TRACE_STEAL() threadingzeug::tracing::steal()
+#define THREADINGZEUG_TRACE_TASK() THREADINGZEUG_TRACE_SCOPE(threadingzeug::tracing::Scope::Kind::Task)
+#define THREADINGZEUG_TRACE_IDLE() THREADINGZEUG_TRACE_SCOPE(threadingzeug::tracing::Scope::Kind::Idle)
+#define THREADINGZEUG_TRACE_CHUNK(first, last) THREADINGZEUG_TRACE_SCOPE(threadingzeug::tracing::Scope::Kind::Chunk, (last) - (first))
+#define THREADINGZEUG_TRACE_LOOP(size, grain, policy) THREADINGZEUG_TRACE_SCOPE(threadingzeug::tracing::Scope::Kind::Loop, size, grain, policy)
+
+#else
+
+#define THREADINGZEUG_TRACE_WORKER(worker)
+#define THREADINGZEUG_TRACE_STEAL()
+#define THREADINGZEUG_TRACE_TASK()
+#define THREADINGZEUG_TRACE_IDLE()
+#define THREADINGZEUG_TRACE_CHUNK(first, last)
+#define THREADINGZEUG_TRACE_LOOP(size, grain, policy)
+
+#endif